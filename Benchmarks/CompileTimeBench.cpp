@@ -0,0 +1,78 @@
+//* Compile time benchmark. Instantiates DLG_BENCH_TYPES distinct delegate signatures, each bound
+//* through every handler kind with and without payloads, the way a large code base does.
+//* Time the compile and compare object sizes, e.g.
+//*   cl /std:c++17 /O2 /c /I.. /DDLG_BENCH_TYPES=200 CompileTimeBench.cpp
+//*   g++ -std=c++17 -O2 -c -I.. -DDLG_BENCH_TYPES=200 CompileTimeBench.cpp
+//* To compare versions, build this file against a second checkout with -I pointing at its headers.
+//* Headers from before this benchmark was added only build with MSVC.
+#include "Delegates.h"
+
+#include <memory>
+#include <utility>
+
+#ifndef DLG_BENCH_TYPES
+#define DLG_BENCH_TYPES 100
+#endif
+
+namespace Bench
+{
+	template <int N> struct Tag { int Value = N; };
+
+	template <int N>
+	struct Listener
+	{
+		int Sum = 0;
+		void On(Tag<N> tag, int a, float) { this->Sum += tag.Value + a; }
+		void OnConst(Tag<N>, int, float) const {}
+		void OnPayload(Tag<N>, int a, float, double, char) { this->Sum += a; }
+		int Get(Tag<N> tag, int a) { return tag.Value + a + this->Sum; }
+	};
+
+	template <int N> void Free(Tag<N>, int, float) {}
+	template <int N> int FreeGet(Tag<N> tag, int a) { return tag.Value * a; }
+
+	template <int N>
+	int Exercise()
+	{
+		Listener<N> raw;
+		auto shared = std::make_shared<Listener<N>>();
+
+		DLG::MultiCastDelegate<Tag<N>, int, float> multi;
+		multi.AddBind(&raw, &Listener<N>::On);
+		multi.AddBind(&raw, &Listener<N>::OnConst);
+		multi.AddBind(shared, &Listener<N>::On);
+		multi.AddBind(&Free<N>);
+		multi.Broadcast(Tag<N>(), N, 1.f);
+		multi.RemoveBind(&raw, &Listener<N>::On);
+
+		DLG::MultiCastDelegate<Tag<N>, int, float, double, char> payload;
+		payload.AddBind(&raw, &Listener<N>::OnPayload, 'c');
+		payload.AddBind(shared, &Listener<N>::OnPayload, 'c');
+		payload.Broadcast(Tag<N>(), N, 1.f, 3.0);
+
+		DLG::SingleCastDelegate<int, Tag<N>, int> single;
+		single.BindRaw(&raw, &Listener<N>::Get);
+		int result = single.Execute(Tag<N>(), N);
+		single.Bind(shared, &Listener<N>::Get);
+		result += single.Execute(Tag<N>(), N);
+		single.BindFunction(&FreeGet<N>);
+		return result + single.Execute(Tag<N>(), N) + raw.Sum;
+	}
+
+	template <int... N>
+	int ExerciseAll(std::integer_sequence<int, N...>)
+	{
+		int results[] = { 0, Exercise<N>()... };
+		int sum = 0;
+		for (int result : results)
+		{
+			sum += result;
+		}
+		return sum;
+	}
+}
+
+int main()
+{
+	return Bench::ExerciseAll(std::make_integer_sequence<int, DLG_BENCH_TYPES>()) == 0 ? 1 : 0;
+}
@@ -0,0 +1,443 @@
+//* Contention benchmark. N publisher threads Broadcast/Execute while M subscriber threads bind, unbind
+//* and destroy targets on the same delegate. Reports publish throughput, churn throughput and
+//* publish latency percentiles, for one thread count or a sweep.
+//*   g++ -std=c++17 -O2 -pthread -I.. ContentionBench.cpp -o ContentionBench
+//*   ContentionBench [-p publishers] [-s subscribers] [-t seconds] [--sweep] [--verify]
+//* --verify runs short rounds that check every call lands on a live target, also with a raw pointer subject
+//* where unbinding is all that protects a target; build it with -fsanitize=thread (or address) to have the
+//* races themselves reported.
+#include "ConcurrentDelegates.h"
+#include "Delegates.h"
+#include "DelegateInstrumentation.h"
+#include "ShardedDelegates.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Bench
+{
+	std::atomic<std::uint64_t> Violations(0);
+
+	using AliveFlag = std::atomic<bool>;
+
+	//* Bind target. Its alive flag is owned by the round, outlives it, and is bound as payload,
+	//* so a call checks it without reading a possibly destroyed Listener.
+	struct Listener
+	{
+		AliveFlag* Alive;
+
+		explicit Listener(AliveFlag* alive) : Alive(alive)
+		{
+			this->Alive->store(true, std::memory_order_release);
+		}
+
+		~Listener()
+		{
+			this->Alive->store(false, std::memory_order_release);
+		}
+
+		void On(int, AliveFlag* alive)
+		{
+			if (alive->load(std::memory_order_acquire) == false)
+			{
+				Violations.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+	};
+
+	using ListenerPtr = std::shared_ptr<Listener>;
+
+	//* Flags of one thread's listeners. A deque never moves its elements.
+	struct FlagArena
+	{
+		std::deque<AliveFlag> Flags;
+
+		ListenerPtr Make()
+		{
+			this->Flags.emplace_back(false);
+			return std::make_shared<Listener>(&this->Flags.back());
+		}
+	};
+
+	//* MultiCastDelegate is not thread safe; every operation takes one mutex.
+	struct LockedMultiCast
+	{
+		DLG::MultiCastDelegate<int, AliveFlag*> Delegate;
+		std::mutex Lock;
+
+		static const char* Name() { return "MultiCastDelegate+mutex"; }
+		static constexpr bool BindsRaw = false;
+		static constexpr std::size_t Held = 8; //targets a subscriber keeps alive after binding the next one.
+
+		void Publish(int value)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			this->Delegate.Broadcast(value);
+		}
+
+		void Subscribe(ListenerPtr& listener)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			this->Delegate.AddBind(listener, &Listener::On, listener->Alive);
+		}
+
+		void Unsubscribe(ListenerPtr& listener)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			this->Delegate.RemoveBind(listener, &Listener::On);
+		}
+
+		void Maintain() {}
+	};
+
+	//* Binds raw pointers and unbinds every target before destroying it, so a call reaching a destroyed
+	//* target means RemoveBind let a bind slip through. Verify only.
+	struct LockedRawMultiCast
+	{
+		DLG::MultiCastDelegate<int, AliveFlag*> Delegate;
+		std::mutex Lock;
+
+		static const char* Name() { return "MultiCastDelegate+mutex raw"; }
+		static constexpr bool BindsRaw = true;
+		static constexpr std::size_t Held = 8;
+
+		void Publish(int value)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			this->Delegate.Broadcast(value);
+		}
+
+		void Subscribe(ListenerPtr& listener)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			this->Delegate.AddBind(listener.get(), &Listener::On, listener->Alive);
+		}
+
+		void Unsubscribe(ListenerPtr& listener)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			this->Delegate.RemoveBind(listener.get(), &Listener::On);
+		}
+
+		void Maintain() {}
+	};
+
+	struct ShardedMultiCast
+	{
+		DLG::ShardedMultiCastDelegate<int, AliveFlag*> Delegate;
+
+		static const char* Name() { return "ShardedMultiCastDelegate"; }
+		static constexpr bool BindsRaw = false;
+		static constexpr std::size_t Held = 8;
+
+		void Publish(int value)
+		{
+			this->Delegate.Broadcast(value);
+		}
+
+		void Subscribe(ListenerPtr& listener)
+		{
+			this->Delegate.AddBind(listener, &Listener::On, listener->Alive);
+		}
+
+		void Unsubscribe(ListenerPtr& listener)
+		{
+			this->Delegate.RemoveBind(listener, &Listener::On);
+		}
+
+		//* Destroyed targets are skipped by Broadcast but only removed by Prune.
+		void Maintain()
+		{
+			this->Delegate.Prune();
+		}
+	};
+
+	//* SingleCastDelegate is not thread safe; every operation takes one mutex. Subscribing rebinds.
+	//* Keeps the bound target alive, Execute on an expired bind logs an error every call.
+	struct LockedSingleCast
+	{
+		DLG::SingleCastDelegate<void, int, AliveFlag*> Delegate;
+		ListenerPtr Bound;
+		std::mutex Lock;
+
+		static const char* Name() { return "SingleCastDelegate+mutex"; }
+		static constexpr bool BindsRaw = false;
+		static constexpr std::size_t Held = 0;
+
+		void Publish(int value)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			if (this->Delegate.IsBound())
+			{
+				this->Delegate.Execute(value);
+			}
+		}
+
+		void Subscribe(ListenerPtr& listener)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			this->Delegate.Bind(listener, &Listener::On, listener->Alive);
+			this->Bound = listener;
+		}
+
+		void Unsubscribe(ListenerPtr& listener)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			if (this->Bound == listener)
+			{
+				this->Delegate.UnBind();
+				this->Bound.reset();
+			}
+		}
+
+		void Maintain() {}
+	};
+
+	//* Execute takes no lock. Subscribers serialize among themselves only to know which listener is bound.
+	//* Bound targets are destroyed while publishers execute; an expired target is skipped silently.
+	struct ConcurrentSingleCast
+	{
+		DLG::ConcurrentSingleCastDelegate<void, int, AliveFlag*> Delegate;
+		const Listener* Bound = nullptr; //identity only, never dereferenced.
+		std::mutex SubscriberLock;
+
+		static const char* Name() { return "ConcurrentSingleCast"; }
+		static constexpr bool BindsRaw = false;
+		static constexpr std::size_t Held = 0;
+
+		void Publish(int value)
+		{
+			if (this->Delegate.IsBound())
+			{
+				this->Delegate.Execute(value);
+			}
+		}
+
+		void Subscribe(ListenerPtr& listener)
+		{
+			std::lock_guard<std::mutex> guard(this->SubscriberLock);
+			this->Delegate.Bind(listener, &Listener::On, listener->Alive);
+			this->Bound = listener.get();
+		}
+
+		void Unsubscribe(ListenerPtr& listener)
+		{
+			std::lock_guard<std::mutex> guard(this->SubscriberLock);
+			if (this->Bound == listener.get())
+			{
+				this->Delegate.UnBind();
+				this->Bound = nullptr;
+			}
+		}
+
+		void Maintain() {}
+	};
+
+	struct Config
+	{
+		unsigned Publishers = 4;
+		unsigned Subscribers = 2;
+		double Seconds = 1.0;
+		bool Sweep = false;
+		bool Verify = false;
+	};
+
+	struct Result
+	{
+		std::uint64_t Publishes = 0;
+		std::uint64_t Churn = 0;
+		double Seconds = 0;
+		std::uint64_t P50 = 0;
+		std::uint64_t P99 = 0;
+		std::uint64_t P999 = 0;
+		std::uint64_t Max = 0;
+	};
+
+	//* Runs one round of 'publishers' and 'subscribers' threads against a fresh SubjectT.
+	template <typename SubjectT>
+	Result Run(unsigned publishers, unsigned subscribers, double seconds)
+	{
+		std::vector<FlagArena> arenas(subscribers + 1); //outlive the subject, and with it every bind.
+		SubjectT subject;
+		std::atomic<bool> start(false);
+		std::atomic<bool> stop(false);
+		std::atomic<std::uint64_t> publishes(0);
+		std::atomic<std::uint64_t> churn(0);
+		std::vector<std::unique_ptr<DLG_Instrumentation::LatencyHistogram>> latencies;
+		std::vector<std::thread> threads;
+
+		//a few binds that live for the whole round, so publishers always have work.
+		std::vector<ListenerPtr> resident(4);
+		for (auto& listener : resident)
+		{
+			listener = arenas[subscribers].Make();
+			subject.Subscribe(listener);
+		}
+
+		for (unsigned p = 0; p < publishers; ++p)
+		{
+			latencies.emplace_back(new DLG_Instrumentation::LatencyHistogram());
+			DLG_Instrumentation::LatencyHistogram* latency = latencies.back().get();
+			threads.emplace_back([&, latency, p]()
+			{
+				while (!start.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+				std::uint64_t count = 0;
+				while (!stop.load(std::memory_order_relaxed))
+				{
+					const std::uint64_t begin = DLG_Instrumentation::Now();
+					subject.Publish(static_cast<int>(p));
+					latency->Record(DLG_Instrumentation::Now() - begin);
+					++count;
+				}
+				publishes.fetch_add(count, std::memory_order_relaxed);
+			});
+		}
+
+		for (unsigned s = 0; s < subscribers; ++s)
+		{
+			threads.emplace_back([&, s]()
+			{
+				while (!start.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+				FlagArena& arena = arenas[s];
+				std::vector<ListenerPtr> held;
+				std::uint64_t count = 0;
+				while (!stop.load(std::memory_order_relaxed))
+				{
+					held.push_back(arena.Make());
+					subject.Subscribe(held.back());
+					if (held.size() > SubjectT::Held)
+					{
+						//alternate between unbinding first and destroying a still bound target.
+						//raw binds must be unbound first.
+						if (SubjectT::BindsRaw || (count + s) % 2 == 0)
+						{
+							subject.Unsubscribe(held.front());
+						}
+						held.erase(held.begin());
+					}
+					if (count % 64 == 0)
+					{
+						subject.Maintain();
+					}
+					++count;
+				}
+				for (auto& listener : held)
+				{
+					subject.Unsubscribe(listener);
+				}
+				churn.fetch_add(count, std::memory_order_relaxed);
+			});
+		}
+
+		const std::uint64_t begin = DLG_Instrumentation::Now();
+		start.store(true, std::memory_order_release);
+		std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+		stop.store(true, std::memory_order_relaxed);
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		Result result;
+		result.Seconds = static_cast<double>(DLG_Instrumentation::Now() - begin) / 1e9;
+		result.Publishes = publishes.load();
+		result.Churn = churn.load();
+		DLG_Instrumentation::LatencyHistogram total;
+		for (const auto& latency : latencies)
+		{
+			total.Merge(*latency);
+		}
+		result.P50 = total.Percentile(50.0);
+		result.P99 = total.Percentile(99.0);
+		result.P999 = total.Percentile(99.9);
+		result.Max = total.MaxValue();
+		return result;
+	}
+
+	template <typename SubjectT>
+	void Report(unsigned publishers, unsigned subscribers, const Result& result)
+	{
+		std::printf("%-26s %4u %4u %14.0f %12.0f %8llu %8llu %8llu %10llu\n", SubjectT::Name(), publishers, subscribers,
+			static_cast<double>(result.Publishes) / result.Seconds, static_cast<double>(result.Churn) / result.Seconds,
+			static_cast<unsigned long long>(result.P50), static_cast<unsigned long long>(result.P99),
+			static_cast<unsigned long long>(result.P999), static_cast<unsigned long long>(result.Max));
+	}
+
+	template <typename SubjectT>
+	void Bench(const Config& config)
+	{
+		if (config.Sweep)
+		{
+			//scaling curve: publishers double up to the hardware threads, subscribers stay fixed.
+			const unsigned hardware = std::thread::hardware_concurrency() == 0 ? 4 : std::thread::hardware_concurrency();
+			for (unsigned publishers = 1; publishers <= hardware; publishers *= 2)
+			{
+				Report<SubjectT>(publishers, config.Subscribers, Run<SubjectT>(publishers, config.Subscribers, config.Seconds));
+			}
+		}
+		else
+		{
+			Report<SubjectT>(config.Publishers, config.Subscribers, Run<SubjectT>(config.Publishers, config.Subscribers, config.Seconds));
+		}
+	}
+
+	//@Return: Amount of failed checks.
+	template <typename SubjectT>
+	int Verify(const Config& config)
+	{
+		Violations.store(0);
+		for (int round = 0; round < 5; ++round)
+		{
+			Run<SubjectT>(config.Publishers, config.Subscribers, 0.05);
+		}
+		const std::uint64_t violations = Violations.load();
+		std::printf("%-26s %s (%llu calls on destroyed targets)\n", SubjectT::Name(), violations == 0 ? "ok" : "FAILED",
+			static_cast<unsigned long long>(violations));
+		return violations == 0 ? 0 : 1;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Bench::Config config;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "-p") == 0 && i + 1 < argc) { config.Publishers = static_cast<unsigned>(std::atoi(argv[++i])); }
+		else if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc) { config.Subscribers = static_cast<unsigned>(std::atoi(argv[++i])); }
+		else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc) { config.Seconds = std::atof(argv[++i]); }
+		else if (std::strcmp(argv[i], "--sweep") == 0) { config.Sweep = true; }
+		else if (std::strcmp(argv[i], "--verify") == 0) { config.Verify = true; }
+		else
+		{
+			std::fprintf(stderr, "usage: %s [-p publishers] [-s subscribers] [-t seconds] [--sweep] [--verify]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	if (config.Verify)
+	{
+		int failed = 0;
+		failed += Bench::Verify<Bench::LockedMultiCast>(config);
+		failed += Bench::Verify<Bench::LockedRawMultiCast>(config);
+		failed += Bench::Verify<Bench::ShardedMultiCast>(config);
+		failed += Bench::Verify<Bench::LockedSingleCast>(config);
+		failed += Bench::Verify<Bench::ConcurrentSingleCast>(config);
+		return failed == 0 ? 0 : 1;
+	}
+
+	std::printf("%-26s %4s %4s %14s %12s %8s %8s %8s %10s\n", "delegate", "pub", "sub", "publish/s", "churn/s", "p50 ns", "p99 ns", "p999 ns", "max ns");
+	Bench::Bench<Bench::LockedMultiCast>(config);
+	Bench::Bench<Bench::ShardedMultiCast>(config);
+	Bench::Bench<Bench::LockedSingleCast>(config);
+	Bench::Bench<Bench::ConcurrentSingleCast>(config);
+	return 0;
+}
@@ -0,0 +1,278 @@
+#pragma once
+#ifndef _COALESCING_DELEGATE_
+#define _COALESCING_DELEGATE_
+#include "Delegates.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//* Multicast delegate that delivers only the latest arguements of a burst of broadcasts.
+//* Format: (DelegateName, type (optional), ...)
+#define COALESCING_MULTI_CAST_DELEGATE(DelegateName, ... ) \
+	using DelegateName = DLG::CoalescingMultiCastDelegate<__VA_ARGS__>;
+
+namespace DLG
+{
+	//* MultiCastDelegate whose Broadcast() stores the arguements in a pending slot instead of calling the binds.
+	//* Later broadcasts overwrite the slot, or are combined into it by the merge function.
+	//* The pending arguements are delivered once by:
+	//*   Flush()                       always.
+	//*   SetMinInterval(interval)      Broadcast() and Poll() deliver when 'interval' passed since the last delivery.
+	//*   SetMaxPending(count)          Broadcast() delivers once 'count' broadcasts are pending.
+	//* With neither policy set only Flush() delivers. Pending arguements are dropped on destruction.
+	//* Only the bind interface of MultiCastDelegate is exposed, so nothing reaches the binds around the pending slot.
+	//* Binds take no payload: every bind is called with the full pending arguements.
+	//* Not thread safe, same as MultiCastDelegate.
+	//* Format: <'arguement type' (optional), ...>
+	template <typename... ParamsT>
+	class CoalescingMultiCastDelegate : private MultiCastDelegate<ParamsT...>
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+		using PendingArgs = std::tuple<typename std::decay<ParamsT>::type...>;
+
+		//* Combines the incoming arguements into the pending ones.
+		//* A captureless lambda converts to this.
+		using MergeFunc = void(*)(PendingArgs& pending, const typename std::decay<ParamsT>::type&... incoming);
+
+	private:
+		using Base = MultiCastDelegate<ParamsT...>;
+		using RetT = void;
+		using FreeFunc = RetT(*)(ParamsT...);
+
+		//* Empty for non class targets, so free functions pick the FreeFunc overloads.
+		template<typename ClassT, typename = void>
+		struct MFSig {};
+
+		template<typename ClassT>
+		struct MFSig<ClassT, typename std::enable_if<std::is_class<ClassT>::value>::type>
+		{
+			using MemberFunctionSignature = RetT(ClassT::*)(ParamsT...);
+			using MemberFunctionConstSignature = RetT(ClassT::*)(ParamsT...) const;
+		};
+
+		std::optional<PendingArgs> Pending;
+		MergeFunc Merge = nullptr;
+		Clock::duration MinInterval = Clock::duration::zero();
+		unsigned MaxPending = 0;
+		unsigned PendingCount = 0;
+		Clock::time_point LastDelivery;
+		std::size_t Coalesced = 0;
+		std::size_t Delivered = 0;
+
+		bool IsDue() const
+		{
+			if (this->MaxPending != 0 && this->PendingCount >= this->MaxPending)
+			{
+				return true;
+			}
+			return this->MinInterval != Clock::duration::zero() && Clock::now() - this->LastDelivery >= this->MinInterval;
+		}
+
+		template <std::size_t... I>
+		void _Deliver(PendingArgs& args, std::index_sequence<I...>)
+		{
+			Base::template Broadcast<ParamsT...>(std::move(std::get<I>(args))...);
+		}
+
+	public:
+		CoalescingMultiCastDelegate() = default;
+
+		CoalescingMultiCastDelegate(const CoalescingMultiCastDelegate&) = delete;
+		CoalescingMultiCastDelegate& operator=(const CoalescingMultiCastDelegate&) = delete;
+
+		using Base::Size;
+		using Base::MemoryUsage;
+		using Base::ShrinkToFit;
+		using Base::HasLiveListeners;
+		using Base::Clear;
+		using Base::RemoveBind;
+		using Base::RemoveBindSingle;
+		using Base::RemoveBindAllInstance;
+		using Base::ContainsBind;
+		using Base::ContainsInstance;
+#ifdef DLG_NAMED_DELEGATES
+		using Base::SetDebugName;
+		using Base::GetDebugName;
+#endif
+#ifdef DLG_INSTRUMENTATION
+		using Base::GetStats;
+#endif
+
+		//* Binds method. Allows duplicates.
+		void AddBind(FreeFunc func)
+		{
+			Base::AddBind(func);
+		}
+
+		//* Binds method provided that it is not already bound.
+		void AddBindUnique(FreeFunc func)
+		{
+			Base::AddBindUnique(func);
+		}
+
+		//* Binds method. Allows duplicates.
+		template <typename ClassT>
+		void AddBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			Base::AddBind(target, func);
+		}
+
+		//* Binds method. Allows duplicates.
+		template <typename ClassT>
+		void AddBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			Base::AddBind(target, func);
+		}
+
+		//* Binds method. Allows duplicates.
+		template <typename ClassT>
+		void AddBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			Base::AddBind(target, func);
+		}
+
+		//* Binds method. Allows duplicates.
+		template <typename ClassT>
+		void AddBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			Base::AddBind(target, func);
+		}
+
+		//* Binds method provided that it is not already bound.
+		template <typename ClassT>
+		void AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			Base::AddBindUnique(target, func);
+		}
+
+		//* Binds method provided that it is not already bound.
+		template <typename ClassT>
+		void AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			Base::AddBindUnique(target, func);
+		}
+
+		//* Binds method provided that it is not already bound.
+		template <typename ClassT>
+		void AddBindUnique(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			Base::AddBindUnique(target, func);
+		}
+
+		//* Binds method provided that it is not already bound.
+		template <typename ClassT>
+		void AddBindUnique(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			Base::AddBindUnique(target, func);
+		}
+
+		//* Stores the arguements for the next delivery; delivers right away if a policy is due.
+		template <typename... ArgsT>
+		void Broadcast(ArgsT... in)
+		{
+			static_assert(sizeof...(ArgsT) == sizeof...(ParamsT), "Coalesced broadcasts take exactly the delegate's arguements.\n");
+			if (this->Pending.has_value())
+			{
+				++this->Coalesced;
+				if (this->Merge != nullptr)
+				{
+					this->Merge(*this->Pending, in...);
+				}
+				else
+				{
+					*this->Pending = PendingArgs(std::forward<ArgsT>(in)...);
+				}
+			}
+			else
+			{
+				this->Pending.emplace(std::forward<ArgsT>(in)...);
+			}
+			++this->PendingCount;
+
+			if (IsDue())
+			{
+				Flush();
+			}
+		}
+
+		template <typename... ArgsT>
+		void operator()(ArgsT... in)
+		{
+			Broadcast(std::forward<ArgsT>(in)...);
+		}
+
+		//* Delivers the pending arguements to the binds. Binds may broadcast again while being called.
+		//@Return: True if arguements were pending.
+		bool Flush()
+		{
+			if (this->Pending.has_value() == false)
+			{
+				return false;
+			}
+			PendingArgs args(std::move(*this->Pending));
+			this->Pending.reset();
+			this->PendingCount = 0;
+			this->LastDelivery = Clock::now();
+			++this->Delivered;
+			_Deliver(args, std::index_sequence_for<ParamsT...>());
+			return true;
+		}
+
+		//* Delivers the pending arguements if the policy is due. Call from a tick loop when using SetMinInterval.
+		//@Return: True if arguements were delivered.
+		bool Poll()
+		{
+			return this->Pending.has_value() && IsDue() && Flush();
+		}
+
+		//* Drops the pending arguements without delivering them.
+		void Discard()
+		{
+			this->Pending.reset();
+			this->PendingCount = 0;
+		}
+
+		bool HasPending() const
+		{
+			return this->Pending.has_value();
+		}
+
+		void SetMerge(MergeFunc merge)
+		{
+			this->Merge = merge;
+		}
+
+		//* Zero disables the time policy.
+		template <typename RepT, typename PeriodT>
+		void SetMinInterval(std::chrono::duration<RepT, PeriodT> interval)
+		{
+			this->MinInterval = std::chrono::duration_cast<Clock::duration>(interval);
+		}
+
+		//* Zero disables the count policy.
+		void SetMaxPending(unsigned count)
+		{
+			this->MaxPending = count;
+		}
+
+		//@Return: Amount of broadcasts folded into an already pending one.
+		std::size_t GetCoalescedCount() const
+		{
+			return this->Coalesced;
+		}
+
+		//@Return: Amount of times the binds were called.
+		std::size_t GetDeliveredCount() const
+		{
+			return this->Delivered;
+		}
+	};
+}
+
+#endif // !_COALESCING_DELEGATE_
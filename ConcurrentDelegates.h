@@ -0,0 +1,236 @@
+#pragma once
+#ifndef _CONCURRENT_DELEGATE_
+#define _CONCURRENT_DELEGATE_
+#include "Delegates.h"
+#include "DelegateEpoch.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+//* Single cast delegate that can be rebound while other threads execute it.
+//* Format: (DelegateName, type (optional), ...)
+#define CONCURRENT_SINGLE_CAST_DELEGATE(DelegateName, ... ) \
+	using DelegateName = DLG::ConcurrentSingleCastDelegate<void, __VA_ARGS__>;
+
+//* Format: (return type, DelegateName, type (optional), ...)
+#define CONCURRENT_SINGLE_CAST_DELEGATE_RetVal(RetT, DelegateName, ... ) \
+	using DelegateName = DLG::ConcurrentSingleCastDelegate<RetT, __VA_ARGS__>;
+
+namespace DLG
+{
+	//* SingleCastDelegate whose handler is an atomic pointer. Execute() loads it once and takes no lock.
+	//* Binding publishes the new handler with one exchange and retires the old one; retired handlers are
+	//* freed once no Execute() can still be running them, by the next bind or UnBind, by Reclaim(), or by
+	//* every ReclaimInterval-th Execute() of a thread while handlers wait.
+	//* Execute() and binding are safe from any thread. Destruction must not race with either.
+	//* Format: <'return type', 'arguement type' (optional), ...>
+	template <typename RetT, typename... ParamsT>
+	class ConcurrentSingleCastDelegate
+	{
+	private:
+		using FreeFunc = RetT(*)(ParamsT...);
+		using Handler = DLG_Details::DelHandlerInterface<RetT>;
+
+		struct Retired
+		{
+			Handler* Bind;
+			std::uint64_t Epoch;
+		};
+
+		static constexpr unsigned ReclaimInterval = 64;
+
+		std::atomic<Handler*> Current;
+		mutable std::mutex RetireLock;
+		mutable std::vector<Retired> RetiredBinds;
+		mutable std::atomic<std::size_t> Waiting{ 0 }; //size of RetiredBinds, read by Execute() without the lock.
+
+		void Publish(Handler* handler)
+		{
+			Handler* old = this->Current.exchange(handler, std::memory_order_seq_cst);
+			if (old != nullptr)
+			{
+				const std::uint64_t epoch = DLG_Details::EpochDomain::Instance().Advance();
+				std::lock_guard<std::mutex> guard(this->RetireLock);
+				this->RetiredBinds.push_back({ old, epoch });
+				this->Waiting.store(this->RetiredBinds.size(), std::memory_order_relaxed);
+			}
+			Reclaim();
+		}
+
+		//* Moves the handlers no Execute() can still be running into 'freed'. Holds RetireLock.
+		//@Return: Amount of retired handlers still waiting.
+		std::size_t Collect(std::vector<Handler*>& freed) const
+		{
+			const std::uint64_t oldest = DLG_Details::EpochDomain::Instance().OldestActive();
+			auto& retired = this->RetiredBinds;
+			for (std::size_t i = 0; i < retired.size(); )
+			{
+				if (retired[i].Epoch < oldest)
+				{
+					freed.push_back(retired[i].Bind);
+					retired[i] = retired.back();
+					retired.pop_back();
+				}
+				else
+				{
+					++i;
+				}
+			}
+			this->Waiting.store(retired.size(), std::memory_order_relaxed);
+			return retired.size();
+		}
+
+		//* Reclaims from Execute() once every ReclaimInterval calls of this thread while handlers wait.
+		//* Skips if a binder holds the lock, so Execute() never blocks.
+		void ReclaimFromExecute() const
+		{
+			thread_local unsigned calls = 0;
+			if (this->Waiting.load(std::memory_order_relaxed) == 0 || ++calls % ReclaimInterval != 0)
+			{
+				return;
+			}
+			std::vector<Handler*> freed;
+			{
+				std::unique_lock<std::mutex> guard(this->RetireLock, std::try_to_lock);
+				if (guard.owns_lock() == false)
+				{
+					return;
+				}
+				Collect(freed);
+			}
+			for (Handler* handler : freed)
+			{
+				delete handler;
+			}
+		}
+
+	public:
+		ConcurrentSingleCastDelegate() : Current(nullptr)
+		{
+			static_assert(std::is_void<RetT>::value == true || std::is_default_constructible<RetT>::value == true
+				, "Return type for a delegate must be default constructable.\n");
+		}
+
+		~ConcurrentSingleCastDelegate()
+		{
+			delete this->Current.load(std::memory_order_relaxed);
+			for (Retired& retired : this->RetiredBinds)
+			{
+				delete retired.Bind;
+			}
+		}
+
+		ConcurrentSingleCastDelegate(const ConcurrentSingleCastDelegate&) = delete;
+		ConcurrentSingleCastDelegate& operator=(const ConcurrentSingleCastDelegate&) = delete;
+
+		//* Binds smart pointer to class and its method.
+		template <class ClassT, typename... ArgsT>
+		void Bind(const std::shared_ptr<ClassT> target, RetT(ClassT::*func)(ParamsT...), ArgsT... in)
+		{
+			Publish(DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds smart pointer to class and its const method.
+		template <class ClassT, typename... ArgsT>
+		void Bind(const std::shared_ptr<ClassT> target, RetT(ClassT::*func)(ParamsT...) const, ArgsT... in)
+		{
+			Publish(DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds free function.
+		template <typename... ArgsT>
+		void BindFunction(FreeFunc func, ArgsT... in)
+		{
+			Publish(DLG_Details::make_FreeDel<RetT>(func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds functor
+		template <typename ClassT, typename... ArgsT>
+		void BindFunctor(ClassT* const target, ArgsT... in)
+		{
+			static_assert(DLG_Details::Details::Traits::is_Functor<RetT, ClassT, ParamsT...>::value
+				, "Object is not a functor or does not properly overload operator() with the paramter or return types specified.\n");
+			Publish(DLG_Details::make_RawDel<RetT>(target, &ClassT::operator(), std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds method.
+		template <class ClassT, typename... ArgsT>
+		void BindRaw(ClassT* const target, RetT(ClassT::*func)(ParamsT...), ArgsT... in)
+		{
+			Publish(DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds const method.
+		template <class ClassT, typename... ArgsT>
+		void BindRaw(ClassT* const target, RetT(ClassT::*func)(ParamsT...) const, ArgsT... in)
+		{
+			Publish(DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* UnBinds the methods attached to this delegate. Executes already running finish with the old bind.
+		void UnBind()
+		{
+			Publish(nullptr);
+		}
+
+		//* True if object and method is bound; False, if not. May change right after returning.
+		bool IsBound() const
+		{
+			return this->Current.load(std::memory_order_acquire) != nullptr;
+		}
+
+		//* Frees retired handlers no Execute() can still be running.
+		//@Return: Amount of retired handlers still waiting.
+		std::size_t Reclaim()
+		{
+			std::vector<Handler*> freed; //destroyed after the lock is released.
+			std::size_t waiting;
+			{
+				std::lock_guard<std::mutex> guard(this->RetireLock);
+				waiting = Collect(freed);
+			}
+			for (Handler* handler : freed)
+			{
+				delete handler;
+			}
+			return waiting;
+		}
+
+		//* Executes bound functions/methods. Unbound, expired or mismatched calls return the default value
+		//* silently; this is the lock free path.
+		template<typename... ArgsT>
+		RetT Execute(ArgsT... in) const
+		{
+			//declared before the guard, so it runs after this call left its epoch.
+			struct ReclaimOnExit
+			{
+				const ConcurrentSingleCastDelegate& Delegate;
+				~ReclaimOnExit() { this->Delegate.ReclaimFromExecute(); }
+			} reclaim{ *this };
+
+			DLG_Details::EpochGuard guard;
+			Handler* const handler = this->Current.load(std::memory_order_seq_cst);
+			auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>,
+				DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(handler);
+			if (sp != nullptr && sp->IsValid() == true) //if calling object is not nullptr
+			{
+				return sp->Execute(std::forward<ArgsT>(in)...);
+			}
+			return RetT();
+		}
+
+		//* Executes bound functions/methods.
+		template <typename... ArgsT>
+		RetT operator()(ArgsT... in) const
+		{
+			return this->Execute(std::forward<ArgsT>(in)...);
+		}
+	};
+}
+
+#endif // !_CONCURRENT_DELEGATE_
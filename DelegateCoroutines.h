@@ -0,0 +1,284 @@
+#pragma once
+#ifndef _DelCoroutines_
+#define _DelCoroutines_
+#include "Delegates.h"
+#include "DelegateMailbox.h"
+
+//* C++20 coroutine support.
+//*   co_await multiCast.Next();          resumes with the arguements of the next Broadcast.
+//*   co_await multiCast.Next(mailbox);   same, resumed on the thread owning 'mailbox'.
+//*   SingleCastDelegate<DLG::Task<T>, ...> binds coroutines; Execute returns an awaitable task.
+#if defined(__cpp_impl_coroutine) || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+
+#include <coroutine>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace DLG
+{
+	//* Awaiter for MultiCastDelegate::Next(). Enlisted in the delegate on suspension, removed by the next Broadcast.
+	//* Destroying the coroutine while it waits removes it from the delegate.
+	//* A coroutine resumed through a mailbox must not be destroyed before that mailbox is pumped.
+	//* The wait list is not locked: suspend on, and destroy waiting coroutines from, the broadcasting thread.
+	template <typename... ParamsT>
+	class NextAwaiter final
+		: private DLG_Details::BroadcastWaiter<ParamsT...>
+		, private MailboxTask
+	{
+	private:
+		DLG_Details::WaiterList<ParamsT...>* List;
+		ThreadMailbox::Ptr Mailbox;
+		std::coroutine_handle<> Handle;
+		std::optional<std::tuple<ParamsT...>> Args;
+
+		virtual void Notify(const ParamsT&... in) override final
+		{
+			this->Args.emplace(in...);
+			if (this->Mailbox != nullptr && this->Mailbox->IsOwnedByCurrentThread() == false)
+			{
+				this->Mailbox->Post(this);
+			}
+			else
+			{
+				this->Handle.resume();
+			}
+		}
+
+		//* Lives in the coroutine frame, the mailbox does not own it. Resuming may free the frame.
+		virtual void Invoke() override final
+		{
+			this->Handle.resume();
+		}
+
+		virtual void Release() override final {}
+
+	public:
+		explicit NextAwaiter(DLG_Details::WaiterList<ParamsT...>& list, const ThreadMailbox::Ptr& mailbox = nullptr)
+			: List(&list), Mailbox(mailbox) {}
+
+		NextAwaiter(const NextAwaiter&) = delete;
+		NextAwaiter& operator=(const NextAwaiter&) = delete;
+
+		bool await_ready() const noexcept
+		{
+			return false;
+		}
+
+		void await_suspend(std::coroutine_handle<> handle)
+		{
+			this->Handle = handle;
+			this->List->Enlist(*this);
+		}
+
+		//@Return: Nothing for a delegate without parameters, the value for one parameter, otherwise a tuple.
+		decltype(auto) await_resume()
+		{
+			if constexpr (sizeof...(ParamsT) == 0)
+			{
+				return;
+			}
+			else if constexpr (sizeof...(ParamsT) == 1)
+			{
+				return std::move(std::get<0>(*this->Args));
+			}
+			else
+			{
+				return std::move(*this->Args);
+			}
+		}
+	};
+
+	template <typename T = void> class Task;
+
+	namespace _task
+	{
+		struct PromiseBase
+		{
+			std::coroutine_handle<> Continuation;
+			std::exception_ptr Exception;
+			bool Detached = false;
+
+			//* Resumes the awaiting coroutine, or frees a detached task.
+			struct FinalAwaiter
+			{
+				bool await_ready() const noexcept { return false; }
+
+				template <typename PromiseT>
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> handle) noexcept
+				{
+					PromiseBase& promise = handle.promise();
+					if (promise.Continuation)
+					{
+						return promise.Continuation;
+					}
+					if (promise.Detached)
+					{
+						if (promise.Exception)
+						{
+							std::cerr << "Unhandled exception in detached delegate task.\n";
+						}
+						handle.destroy();
+					}
+					return std::noop_coroutine();
+				}
+
+				void await_resume() const noexcept {}
+			};
+
+			std::suspend_always initial_suspend() const noexcept { return {}; }
+			FinalAwaiter final_suspend() const noexcept { return {}; }
+
+			void unhandled_exception()
+			{
+				this->Exception = std::current_exception();
+			}
+
+			void Rethrow() const
+			{
+				if (this->Exception)
+				{
+					std::rethrow_exception(this->Exception);
+				}
+			}
+		};
+
+		template <typename T>
+		struct Promise final : public PromiseBase
+		{
+			std::optional<T> Value;
+
+			Task<T> get_return_object();
+
+			template <typename U>
+			void return_value(U&& value)
+			{
+				this->Value.emplace(std::forward<U>(value));
+			}
+
+			T Result()
+			{
+				Rethrow();
+				return std::move(*this->Value);
+			}
+		};
+
+		template <>
+		struct Promise<void> final : public PromiseBase
+		{
+			Task<void> get_return_object();
+
+			void return_void() {}
+
+			void Result()
+			{
+				Rethrow();
+			}
+		};
+	}
+
+	//* Lazily started coroutine. Starts when awaited, or when detached.
+	//* A default constructed task is empty; awaiting it yields T() immediately, matching an unbound delegate.
+	template <typename T>
+	class Task final
+	{
+	public:
+		using promise_type = _task::Promise<T>;
+
+	private:
+		std::coroutine_handle<promise_type> Handle;
+
+	public:
+		Task() : Handle(nullptr) {}
+		explicit Task(std::coroutine_handle<promise_type> handle) : Handle(handle) {}
+
+		Task(Task&& other) noexcept : Handle(std::exchange(other.Handle, nullptr)) {}
+
+		Task& operator=(Task&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (this->Handle)
+				{
+					this->Handle.destroy();
+				}
+				this->Handle = std::exchange(other.Handle, nullptr);
+			}
+			return *this;
+		}
+
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+
+		~Task()
+		{
+			if (this->Handle)
+			{
+				this->Handle.destroy();
+			}
+		}
+
+		bool IsValid() const
+		{
+			return static_cast<bool>(this->Handle);
+		}
+
+		//* Starts the task without awaiting it. The coroutine frees itself when it finishes.
+		void Detach()
+		{
+			if (this->Handle)
+			{
+				std::coroutine_handle<promise_type> handle = std::exchange(this->Handle, nullptr);
+				handle.promise().Detached = true;
+				handle.resume();
+			}
+		}
+
+		bool await_ready() const noexcept
+		{
+			return !this->Handle || this->Handle.done();
+		}
+
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+		{
+			this->Handle.promise().Continuation = awaiting;
+			return this->Handle;
+		}
+
+		T await_resume()
+		{
+			if (!this->Handle)
+			{
+				if constexpr (std::is_void<T>::value)
+				{
+					return;
+				}
+				else
+				{
+					return T();
+				}
+			}
+			return this->Handle.promise().Result();
+		}
+	};
+
+	namespace _task
+	{
+		template <typename T>
+		Task<T> Promise<T>::get_return_object()
+		{
+			return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+		}
+
+		inline Task<void> Promise<void>::get_return_object()
+		{
+			return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+		}
+	}
+}
+
+#endif // coroutines
+#endif // !_DelCoroutines_
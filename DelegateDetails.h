@@ -7,6 +7,18 @@
 #include <memory>
 #include <type_traits>
 #include <typeinfo>
+#include <new>
+#include <cstddef>
+#include <cassert>
+#ifdef DLG_MEMORY_ACCOUNTING
+#include <atomic>
+#endif
+
+//* Alignment of data written by one thread and scanned by others (sharded binds, epoch records),
+//* so writers never invalidate each other's cache line.
+#ifndef DLG_CACHE_LINE_SIZE
+#define DLG_CACHE_LINE_SIZE 64
+#endif
 
 namespace DLG_Details
 {
@@ -19,11 +31,234 @@ namespace DLG_Details
 	//* struct for allowing for multiple patckings in a templated class.
 	template<typename... Types> struct TypeGroup {};
 
+	//* Memory held by a delegate, or by every handler in the process (see GlobalMemory).
+	//* Heap allocator overhead and shared_ptr control blocks (owned by the target) are not included.
+	struct MemoryUsage
+	{
+		std::size_t Binds = 0;          //handlers held.
+		std::size_t DeadBinds = 0;      //handlers whose target expired but have not been pruned yet.
+		std::size_t HandlerBytes = 0;   //size of the handlers, payload included.
+		std::size_t PayloadBytes = 0;   //part of HandlerBytes used by bound payload arguements.
+		std::size_t StorageBytes = 0;   //bind list storage owned by the delegate.
+		std::size_t SlackBytes = 0;     //part of StorageBytes reserved but unused.
+
+		std::size_t TotalBytes() const
+		{
+			return this->HandlerBytes + this->StorageBytes;
+		}
+
+		MemoryUsage& operator+=(const MemoryUsage& other)
+		{
+			this->Binds += other.Binds;
+			this->DeadBinds += other.DeadBinds;
+			this->HandlerBytes += other.HandlerBytes;
+			this->PayloadBytes += other.PayloadBytes;
+			this->StorageBytes += other.StorageBytes;
+			this->SlackBytes += other.SlackBytes;
+			return *this;
+		}
+	};
+
+#ifdef DLG_MEMORY_ACCOUNTING
+	//* Process wide handler totals. Only tracked when DLG_MEMORY_ACCOUNTING is defined.
+	//* Counts every live handler, including those of inplace delegates, which sit in the delegate's own storage.
+	struct GlobalMemory final
+	{
+		static std::atomic<std::size_t>& LiveHandlers() { static std::atomic<std::size_t> value(0); return value; }
+		static std::atomic<std::size_t>& HandlerBytes() { static std::atomic<std::size_t> value(0); return value; }
+		static std::atomic<std::size_t>& PayloadBytes() { static std::atomic<std::size_t> value(0); return value; }
+
+		static void Track(std::size_t handlerBytes, std::size_t payloadBytes)
+		{
+			LiveHandlers().fetch_add(1, std::memory_order_relaxed);
+			HandlerBytes().fetch_add(handlerBytes, std::memory_order_relaxed);
+			PayloadBytes().fetch_add(payloadBytes, std::memory_order_relaxed);
+		}
+
+		static void Untrack(std::size_t handlerBytes, std::size_t payloadBytes)
+		{
+			LiveHandlers().fetch_sub(1, std::memory_order_relaxed);
+			HandlerBytes().fetch_sub(handlerBytes, std::memory_order_relaxed);
+			PayloadBytes().fetch_sub(payloadBytes, std::memory_order_relaxed);
+		}
+
+		static MemoryUsage Snapshot()
+		{
+			MemoryUsage usage;
+			usage.Binds = LiveHandlers().load(std::memory_order_relaxed);
+			usage.HandlerBytes = HandlerBytes().load(std::memory_order_relaxed);
+			usage.PayloadBytes = PayloadBytes().load(std::memory_order_relaxed);
+			return usage;
+		}
+	};
+#endif
+
+	namespace Details
+	{
+		namespace FunctionCasting
+		{
+			template<typename RetT, typename... ParamsT>
+			const void* const void_cast(RetT(*func)(ParamsT...))
+			{
+				union {
+					RetT(*pf)(ParamsT...);
+					void* p;
+				};
+				pf = func;
+				return p;
+			}
+			
+			template<typename RetT, typename ClassT, typename... ParamsT>
+			const void* const void_cast(RetT(ClassT::*func)(ParamsT...))
+			{
+				union {
+					RetT(ClassT::*pf)(ParamsT...);
+					void* p;
+				};
+				pf = func;
+				return p;
+			}
+			
+			template<typename RetT, typename ClassT, typename... ParamsT>
+			const void* const void_cast(RetT(ClassT::*func)(ParamsT...) const)
+			{
+				union {
+					RetT(ClassT::*pf)(ParamsT...) const;
+					void* p;
+				};
+				pf = func;
+				return p;
+			}
+
+			template<typename RetT, typename... ParamsT>
+			bool is_equal(RetT(*func1)(ParamsT...), const void* func2)
+			{
+				return (void_cast(func1) == func2);
+			}
+
+			template<typename RetT, typename ClassT, typename... ParamsT>
+			bool is_equal(RetT(ClassT::*func1)(ParamsT...), const void* func2)
+			{
+				return (void_cast(func1) == func2);
+			}
+
+			template<typename RetT, typename ClassT, typename... ParamsT>
+			bool is_equal(RetT(ClassT::*func1)(ParamsT...) const, const void* func2)
+			{
+				return (void_cast(func1) == func2);
+			}
+			//template<typename RetT, typename... ParamsT>
+			//bool is_equal(RetT(*func1)(ParamsT...), const std::size_t& func2)
+			//{
+			//	std::size_t s = typeid(RetT(*)(ParamsT...)).hash_code();
+			//	return (s == func2);
+			//}
+			//
+			//template<typename RetT, typename ClassT, typename... ParamsT>
+			//bool is_equal(RetT(ClassT::*func1)(ParamsT...), const std::size_t& func2)
+			//{
+			//	std::size_t s = typeid(RetT(ClassT::*)(ParamsT...)).hash_code();
+			//	return (s == func2);
+			//}
+			//
+			//template<typename RetT, typename ClassT, typename... ParamsT>
+			//bool is_equal(RetT(ClassT::*func1)(ParamsT...) const, const std::size_t& func2)
+			//{
+			//		std::size_t s = typeid(RetT(ClassT::*)(ParamsT...) const).hash_code();
+			//		return (s == func2);
+			//}
+		}
+
+		namespace Traits
+		{
+			template<typename...> struct are_args_same;
+
+			//* Checks that T is a functor with specified types.
+			template <typename ReturnT, typename ClassT, typename... ArgsT>
+			struct is_Functor final
+			{
+			private:
+				struct BadType final {};
+				template <class U> static decltype(std::declval<U>().operator()(std::declval<ArgsT>()...)) Test(int);
+				template <class U> static BadType Test(...);
+			public:
+				static constexpr bool value = std::is_convertible<decltype(Test<ClassT>(0)), ReturnT>::value;
+			};
+
+			//* Checks that two parameter packs are equal. One instantiation, whatever the pack length.
+			template<template<typename...> typename TypeGrouping, typename... As, typename... Bs>
+			struct are_args_same<TypeGrouping<As...>, TypeGrouping<Bs...>> final
+				: std::is_same<TypeGroup<As...>, TypeGroup<Bs...>> {};
+
+			//* Pack indexing without recursion: overload resolution picks the base holding index I.
+			template<size_t I, typename T> struct indexed_type { using type = T; };
+
+			template<typename, typename...> struct indexed_types;
+			template<size_t... I, typename... Ts>
+			struct indexed_types<std::index_sequence<I...>, Ts...> : indexed_type<I, Ts>... {};
+
+			template<size_t I, typename T>
+			indexed_type<I, T> select_type(const indexed_type<I, T>&);
+
+			//* First 'Count' types of Ts, as a TypeGroup.
+			template<size_t Count, typename... Ts>
+			struct front_types final
+			{
+			private:
+				using Indexed = indexed_types<std::index_sequence_for<Ts...>, Ts...>;
+
+				template<size_t... I>
+				static TypeGroup<typename decltype(select_type<I>(std::declval<Indexed>()))::type...> take(std::index_sequence<I...>);
+			public:
+				using type = decltype(take(std::make_index_sequence<Count>()));
+			};
+
+			template<typename... As, typename... Bs>
+			TypeGroup<As..., Bs...> concat_types(TypeGroup<As...>, TypeGroup<Bs...>);
+		}
+
+		namespace TupleDetails
+		{
+			//* Invoke free function helper.
+			template <typename FreeFunc, typename... BArgsT, size_t... I, typename... EArgsT>
+			constexpr decltype(auto) invoke_impl(const FreeFunc& f, const std::tuple<BArgsT...>& payLoad, const std::index_sequence<I...>&, EArgsT&&... in)
+			{
+				return f(std::forward<EArgsT>(in)..., std::get<I>(payLoad)...);
+			}
+
+			//* Calls free function with the execute args followed by the payload. No intermediate tuple.
+			template <typename FreeFunc, typename... BArgsT, typename... EArgsT>
+			constexpr decltype(auto) invoke(const FreeFunc& f, const std::tuple<BArgsT...>& payLoad, EArgsT&&... in)
+			{
+				return invoke_impl(f, payLoad, std::index_sequence_for<BArgsT...>(), std::forward<EArgsT>(in)...);
+			}
+			//------------------------------------------
+
+			//* Invoke member function helper.
+			template <typename ClassT, typename FuncT, typename... BArgsT, size_t... I, typename... EArgsT>
+			constexpr decltype(auto) invoke_impl(ClassT* obj, const FuncT& f, const std::tuple<BArgsT...>& payLoad, const std::index_sequence<I...>&, EArgsT&&... in)
+			{
+				return ((*obj).*f)(std::forward<EArgsT>(in)..., std::get<I>(payLoad)...);
+			}
+
+			//* Calls member function with the execute args followed by the payload. No intermediate tuple.
+			template <typename ClassT, typename FuncT, typename... BArgsT, typename... EArgsT>
+			constexpr decltype(auto) invoke(ClassT* obj, const FuncT& f, const std::tuple<BArgsT...>& payLoad, EArgsT&&... in)
+			{
+				return invoke_impl(obj, f, payLoad, std::index_sequence_for<BArgsT...>(), std::forward<EArgsT>(in)...);
+			}
+		}
+
+		using namespace FunctionCasting;
+		using namespace TupleDetails;
+	}
+
 	//* DelHander <template> bases.
 	template<typename...> struct DelHandler; //used during execution.
 	template<typename...> struct FreeDelHandler; //created by maker during bindings.
 	template<typename...> struct MemberDelHandler;
 	template<typename...> struct RawDelHandler;
+	template<typename...> struct PipelineDelHandler; //Filter/Map stages fused with their target.
 	
 	/*
 			   A
@@ -61,8 +296,23 @@ namespace DLG_Details
 		virtual ~DelHandlerInterface() {};
 
 		virtual bool IsValid() const { return true; }
-		virtual const void* const GetObjectPointer() const { return nullptr; }
+		//* True if IsValid() may turn false after binding, as for shared_ptr binds.
+		virtual bool CanExpire() const { return false; }
+		virtual const void* GetObjectPointer() const { return nullptr; }
 		virtual const void* GetMemberFuncPointer() const { return 0; }
+		//* Size of the concrete handler, payload included.
+		virtual std::size_t GetHandlerSize() const { return sizeof(*this); }
+		//* Size of the bound payload arguements.
+		virtual std::size_t GetPayloadSize() const { return 0; }
+
+		//* Adds this handler to 'usage'.
+		void AccumulateMemory(MemoryUsage& usage) const
+		{
+			++usage.Binds;
+			usage.DeadBinds += IsValid() ? 0 : 1;
+			usage.HandlerBytes += GetHandlerSize();
+			usage.PayloadBytes += GetPayloadSize();
+		}
 	};
 
 	//* DelHolder2, never instantiated alone. Used during Execute()
@@ -71,9 +321,9 @@ namespace DLG_Details
 		: public DelHandlerInterface<RetT>
 	{
 	protected:
-		DelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<EArgsT...>>()
+		DelHandler()
 			: DelHandlerInterface<RetT>() {}
-		virtual ~DelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<EArgsT...>>() {};
+		virtual ~DelHandler() {};
 
 	public:
 		virtual RetT Execute(EArgsT... in) const = 0;
@@ -89,17 +339,25 @@ namespace DLG_Details
 		std::tuple<BArgsT...> t;
 
 	public:
-		FreeDelHandler<TypeGrouping<RetT, FuncT, ParamsT...>, TypeGrouping<EArgsT...>, TypeGrouping<BArgsT...>>
-			(FuncT func, const std::tuple<BArgsT...>& t) 
+		FreeDelHandler(FuncT func, const std::tuple<BArgsT...>& t) 
 			: DelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<EArgsT...>>()
-			, Function(func), t(t) {}
+			, Function(func), t(t)
+		{
+#ifdef DLG_MEMORY_ACCOUNTING
+			GlobalMemory::Track(sizeof(*this), GetPayloadSize());
+#endif
+		}
 
-		virtual ~FreeDelHandler<TypeGrouping<RetT, FuncT, ParamsT...>, TypeGrouping<EArgsT...>, TypeGrouping<BArgsT...>>() {}
+		virtual ~FreeDelHandler() 
+		{
+#ifdef DLG_MEMORY_ACCOUNTING
+			GlobalMemory::Untrack(sizeof(*this), GetPayloadSize());
+#endif
+		}
 
 		virtual RetT Execute(EArgsT... in) const override final
 		{
-			return Details::apply(this->Function
-				, std::tuple_cat(std::tuple<EArgsT...>(in...), this->t));
+			return Details::invoke(this->Function, this->t, std::forward<EArgsT>(in)...);
 		}
 
 		virtual FuncT GetFunctionPointer() const
@@ -112,6 +370,16 @@ namespace DLG_Details
 			//return typeid(FuncT).hash_code();
 			return Details::void_cast(this->Function);
 		}
+
+		virtual std::size_t GetHandlerSize() const override final
+		{
+			return sizeof(*this);
+		}
+
+		virtual std::size_t GetPayloadSize() const override final
+		{
+			return (sizeof...(BArgsT) == 0) ? 0 : sizeof(this->t);
+		}
 	};
 
 	//* MemberDelHandler, the one always instantiated. Used during Binding()
@@ -125,20 +393,31 @@ namespace DLG_Details
 		std::tuple<BArgsT...> t;
 
 	public:
-		MemberDelHandler<TypeGrouping<RetT, ClassT, FuncT, ParamsT...>, TypeGrouping<EArgsT...>, TypeGrouping<BArgsT...>>
-			(std::shared_ptr<ClassT> target, FuncT func, const std::tuple<BArgsT...>& t) 
+		MemberDelHandler(std::shared_ptr<ClassT> target, FuncT func, const std::tuple<BArgsT...>& t) 
 			: DelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<EArgsT...>>()
-			, Object(target), Function(func), t(t) {}
+			, Object(target), Function(func), t(t)
+		{
+#ifdef DLG_MEMORY_ACCOUNTING
+			GlobalMemory::Track(sizeof(*this), GetPayloadSize());
+#endif
+		}
 
-		virtual ~MemberDelHandler<TypeGrouping<RetT, ClassT, FuncT, ParamsT...>, TypeGrouping<EArgsT...>, TypeGrouping<BArgsT...>>() 
+		virtual ~MemberDelHandler() 
 		{
+#ifdef DLG_MEMORY_ACCOUNTING
+			GlobalMemory::Untrack(sizeof(*this), GetPayloadSize());
+#endif
 			this->Object.reset();
 		}
 
 		virtual RetT Execute(EArgsT... in) const override final
 		{
-			return Details::apply(this->Object.lock().get(), this->Function
-				, std::tuple_cat(std::tuple<EArgsT...>(in...), this->t));
+			const std::shared_ptr<ClassT> object = this->Object.lock();
+			if (object == nullptr) //expired after the caller's IsValid() check.
+			{
+				return RetT();
+			}
+			return Details::invoke(object.get(), this->Function, this->t, std::forward<EArgsT>(in)...);
 		}
 
 		virtual bool IsValid() const override final
@@ -146,7 +425,12 @@ namespace DLG_Details
 			return !this->Object.expired();
 		}
 
-		virtual const void* const GetObjectPointer() const override final
+		virtual bool CanExpire() const override final
+		{
+			return true;
+		}
+
+		virtual const void* GetObjectPointer() const override final
 		{
 			return static_cast<void*>(this->Object.lock().get());
 		}
@@ -161,6 +445,16 @@ namespace DLG_Details
 			//return typeid(FuncT).hash_code();
 			return Details::void_cast(this->Function);
 		}
+
+		virtual std::size_t GetHandlerSize() const override final
+		{
+			return sizeof(*this);
+		}
+
+		virtual std::size_t GetPayloadSize() const override final
+		{
+			return (sizeof...(BArgsT) == 0) ? 0 : sizeof(this->t);
+		}
 	};
 
 	//* RawDelHandler, the one always instantiated. Used during Binding()
@@ -174,17 +468,25 @@ namespace DLG_Details
 		std::tuple<BArgsT...> t;
 
 	public:
-		RawDelHandler<TypeGrouping<RetT, ClassT, FuncT, ParamsT...>, TypeGrouping<EArgsT...>, TypeGrouping<BArgsT...>>
-			(ClassT* target, FuncT func, const std::tuple<BArgsT...>& t) 
+		RawDelHandler(ClassT* target, FuncT func, const std::tuple<BArgsT...>& t) 
 			: DelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<EArgsT...>>()
-			, Object(target), Function(func), t(t) {}
+			, Object(target), Function(func), t(t)
+		{
+#ifdef DLG_MEMORY_ACCOUNTING
+			GlobalMemory::Track(sizeof(*this), GetPayloadSize());
+#endif
+		}
 
-		virtual ~RawDelHandler<TypeGrouping<RetT, ClassT, FuncT, ParamsT...>, TypeGrouping<EArgsT...>, TypeGrouping<BArgsT...>>() {}
+		virtual ~RawDelHandler() 
+		{
+#ifdef DLG_MEMORY_ACCOUNTING
+			GlobalMemory::Untrack(sizeof(*this), GetPayloadSize());
+#endif
+		}
 
 		virtual RetT Execute(EArgsT... in) const override final
 		{
-			return Details::apply(this->Object, this->Function
-				, std::tuple_cat(std::tuple<EArgsT...>(in...), this->t));
+			return Details::invoke(this->Object, this->Function, this->t, std::forward<EArgsT>(in)...);
 		}
 
 		virtual bool IsValid() const override final
@@ -192,7 +494,7 @@ namespace DLG_Details
 			return (this->Object != nullptr);
 		}
 
-		virtual const void* const GetObjectPointer() const override final
+		virtual const void* GetObjectPointer() const override final
 		{
 			return static_cast<void*>(this->Object);
 		}
@@ -207,6 +509,210 @@ namespace DLG_Details
 			//return typeid(FuncT).hash_code();
 			return Details::void_cast(this->Function);
 		}
+
+		virtual std::size_t GetHandlerSize() const override final
+		{
+			return sizeof(*this);
+		}
+
+		virtual std::size_t GetPayloadSize() const override final
+		{
+			return (sizeof...(BArgsT) == 0) ? 0 : sizeof(this->t);
+		}
+	};
+
+	//* Pipeline stage skipping the rest of the pipeline when Pred(args...) is false.
+	template<typename PredT>
+	struct FilterStage
+	{
+		PredT Pred;
+	};
+
+	//* Pipeline stage replacing the arguements with Fn(args...). A returned std::tuple is expanded.
+	template<typename FnT>
+	struct MapStage
+	{
+		FnT Fn;
+	};
+
+	//* Pipeline target calling a function pointer or functor stored by value.
+	//* Targets convert the result straight to the delegate's return type in Call<RetT>().
+	template<typename FnT>
+	struct CallableTarget
+	{
+		FnT Fn;
+
+		bool IsValid() const { return true; }
+		bool CanExpire() const { return false; }
+		const void* GetObjectPointer() const { return nullptr; }
+
+		const void* GetMemberFuncPointer() const
+		{
+			if constexpr (std::is_pointer<FnT>::value && std::is_function<typename std::remove_pointer<FnT>::type>::value)
+			{
+				return Details::void_cast(this->Fn);
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+
+		template<typename RetT, typename... ArgsT>
+		RetT Call(ArgsT&&... in) const
+		{
+			return static_cast<RetT>(this->Fn(std::forward<ArgsT>(in)...));
+		}
+	};
+
+	//* Pipeline target calling a method on a raw pointer.
+	template<typename ClassT, typename FuncT>
+	struct RawTarget
+	{
+		ClassT* Object;
+		FuncT Function;
+
+		bool IsValid() const { return this->Object != nullptr; }
+		bool CanExpire() const { return false; }
+		const void* GetObjectPointer() const { return static_cast<void*>(this->Object); }
+		const void* GetMemberFuncPointer() const { return Details::void_cast(this->Function); }
+
+		template<typename RetT, typename... ArgsT>
+		RetT Call(ArgsT&&... in) const
+		{
+			return static_cast<RetT>(((*this->Object).*(this->Function))(std::forward<ArgsT>(in)...));
+		}
+	};
+
+	//* Pipeline target calling a method on a weakly held object.
+	template<typename ClassT, typename FuncT>
+	struct WeakTarget
+	{
+		std::weak_ptr<ClassT> Object;
+		FuncT Function;
+
+		bool IsValid() const { return !this->Object.expired(); }
+		bool CanExpire() const { return true; }
+		const void* GetObjectPointer() const { return static_cast<void*>(this->Object.lock().get()); }
+		const void* GetMemberFuncPointer() const { return Details::void_cast(this->Function); }
+
+		//* Returns the default value if the object expired after the caller's IsValid() check.
+		template<typename RetT, typename... ArgsT>
+		RetT Call(ArgsT&&... in) const
+		{
+			const std::shared_ptr<ClassT> object = this->Object.lock();
+			if (object == nullptr)
+			{
+				return RetT();
+			}
+			return static_cast<RetT>(((*object).*(this->Function))(std::forward<ArgsT>(in)...));
+		}
+	};
+
+	//* PipelineDelHandler, built by PipelineBuilder. Every stage and the target are members known at compile time,
+	//* so a pipeline costs the one virtual Execute() call of any other handler.
+	template<template<typename...> typename TypeGrouping, typename RetT, typename... ParamsT, typename TargetT, typename... StagesT>
+	struct PipelineDelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TargetT, TypeGrouping<StagesT...>> final
+		: public DelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<ParamsT...>>
+	{
+	private:
+		TargetT Target;
+		std::tuple<StagesT...> Stages;
+
+		template<std::size_t I, typename... ArgsT>
+		RetT Run(ArgsT&&... in) const
+		{
+			if constexpr (I == sizeof...(StagesT))
+			{
+				return this->Target.template Call<RetT>(std::forward<ArgsT>(in)...);
+			}
+			else
+			{
+				return Step<I>(std::get<I>(this->Stages), std::forward<ArgsT>(in)...);
+			}
+		}
+
+		template<std::size_t I, typename PredT, typename... ArgsT>
+		RetT Step(const FilterStage<PredT>& stage, ArgsT&&... in) const
+		{
+			if (stage.Pred(in...))
+			{
+				return Run<I + 1>(std::forward<ArgsT>(in)...);
+			}
+			return RetT();
+		}
+
+		template<std::size_t I, typename FnT, typename... ArgsT>
+		RetT Step(const MapStage<FnT>& stage, ArgsT&&... in) const
+		{
+			static_assert(!std::is_void<decltype(stage.Fn(std::forward<ArgsT>(in)...))>::value, "Map stage must return the new arguements.\n");
+			return Forward<I + 1>(stage.Fn(std::forward<ArgsT>(in)...));
+		}
+
+		template<std::size_t I, typename ValueT>
+		RetT Forward(ValueT&& value) const
+		{
+			return Run<I>(std::forward<ValueT>(value));
+		}
+
+		template<std::size_t I, typename... ValuesT>
+		RetT Forward(std::tuple<ValuesT...>&& values) const
+		{
+			return Expand<I>(values, std::index_sequence_for<ValuesT...>());
+		}
+
+		template<std::size_t I, typename... ValuesT, std::size_t... J>
+		RetT Expand(std::tuple<ValuesT...>& values, std::index_sequence<J...>) const
+		{
+			return Run<I>(std::move(std::get<J>(values))...);
+		}
+
+	public:
+		PipelineDelHandler(TargetT target, std::tuple<StagesT...> stages)
+			: DelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<ParamsT...>>()
+			, Target(std::move(target)), Stages(std::move(stages))
+		{
+#ifdef DLG_MEMORY_ACCOUNTING
+			GlobalMemory::Track(sizeof(*this), 0);
+#endif
+		}
+
+		virtual ~PipelineDelHandler()
+		{
+#ifdef DLG_MEMORY_ACCOUNTING
+			GlobalMemory::Untrack(sizeof(*this), 0);
+#endif
+		}
+
+		virtual RetT Execute(ParamsT... in) const override final
+		{
+			return Run<0>(std::forward<ParamsT>(in)...);
+		}
+
+		virtual bool IsValid() const override final
+		{
+			return this->Target.IsValid();
+		}
+
+		virtual bool CanExpire() const override final
+		{
+			return this->Target.CanExpire();
+		}
+
+		virtual const void* GetObjectPointer() const override final
+		{
+			return this->Target.GetObjectPointer();
+		}
+
+		virtual const void* GetMemberFuncPointer() const override final
+		{
+			return this->Target.GetMemberFuncPointer();
+		}
+
+		virtual std::size_t GetHandlerSize() const override final
+		{
+			return sizeof(*this);
+		}
 	};
 
 	//* makeDel namespace
@@ -215,7 +721,7 @@ namespace DLG_Details
 		//* Creates delegate handler with split paramter pack. Split between the payload types and the rest of the types.
 		template<typename RetT, typename ClassT, typename FuncT, typename... ParamsT, typename... EArgsT, typename... BArgsT>
 		DelHandlerInterface<RetT>* _makeMemberDel_Impl(const std::shared_ptr<ClassT>& target, FuncT func,
-			const std::tuple<ParamsT...>& allT, const std::tuple<EArgsT...>& params, const std::tuple<BArgsT...>& args)
+			const std::tuple<ParamsT...>&, TypeGroup<EArgsT...>, const std::tuple<BArgsT...>& args)
 		{
 			return new MemberDelHandler<TypeGroup<RetT, ClassT, FuncT, ParamsT...>
 				, TypeGroup<EArgsT...>, TypeGroup<BArgsT...>>(target, func, args);
@@ -224,7 +730,7 @@ namespace DLG_Details
 		//* Creates delegate handler with split paramter pack. Split between the payload types and the rest of the types.
 		template<typename RetT, typename ClassT, typename FuncT, typename... ParamsT, typename... EArgsT, typename... BArgsT>
 		DelHandlerInterface<RetT>* _makeRawDel_Impl(ClassT* const target, FuncT func,
-			const std::tuple<ParamsT...>& allT, const std::tuple<EArgsT...>& params, const std::tuple<BArgsT...>& args)
+			const std::tuple<ParamsT...>&, TypeGroup<EArgsT...>, const std::tuple<BArgsT...>& args)
 		{
 			return new RawDelHandler<TypeGroup<RetT, ClassT, FuncT, ParamsT...>
 				, TypeGroup<EArgsT...>, TypeGroup<BArgsT...>>(target, func, args);
@@ -233,22 +739,23 @@ namespace DLG_Details
 		//* Creates delegate handler with split paramter pack. Split between the payload types and the rest of the types.
 		template<typename RetT, typename FuncT, typename... ParamsT, typename... EArgsT, typename... BArgsT>
 		DelHandlerInterface<RetT>* _makeFreeDel_Impl(FuncT func,
-			const std::tuple<ParamsT...>&, const std::tuple<EArgsT...>&, const std::tuple<BArgsT...>& args)
+			const std::tuple<ParamsT...>&, TypeGroup<EArgsT...>, const std::tuple<BArgsT...>& args)
 		{
 			return new FreeDelHandler<TypeGroup<RetT, FuncT, ParamsT...>
 				, TypeGroup<EArgsT...>, TypeGroup<BArgsT...>>(func, args);
 		}
 
 		//* Asserts aguement size and equality and returns truncated paramter type list from Bs.
-		//* Helper function for make_dels.
+		//* Helper function for make_dels. Works on types only, nothing is copied.
 		template<typename... As, typename... Bs>
-		constexpr decltype(auto) getArgs(std::tuple<As...> allTuple, std::tuple<Bs...> payLoad)
+		constexpr decltype(auto) getArgs(const std::tuple<As...>&, const std::tuple<Bs...>&)
 		{
 			static_assert(sizeof...(As) >= sizeof...(Bs), "To many arguements in Bind.\n"); //error check
-			//Details::Traits::assert_size_gt(allTuple, payLoad);
-			const auto params = Details::TupleDetails::take_front<sizeof...(Bs)>(allTuple);
-			Details::Traits::assert_packs_same(allTuple, std::tuple_cat(params, payLoad)); //error check
-			return params;
+			using ParamsT = typename Details::Traits::front_types<(sizeof...(As) >= sizeof...(Bs)) ? sizeof...(As) - sizeof...(Bs) : 0, As...>::type;
+			static_assert(Details::Traits::are_args_same<TypeGroup<As...>,
+				decltype(Details::Traits::concat_types(ParamsT(), TypeGroup<Bs...>()))>::value,
+				"Argument types do not match function signature."); //error check
+			return ParamsT();
 		}
 	}
 
@@ -256,7 +763,7 @@ namespace DLG_Details
 	* these exist because bind types and execute types need to be split from all paramters
 	* where _..._Impl functions use the deduced execution arg types to construct delegate handlers.
 	*/
-	namespace
+	inline namespace _bind //named, so translation units share one instantiation.
 	{
 		//* Creates delegate handler with split paramter pack. Split between the payload types and the rest of the types.
 		template<typename RetT, typename ClassT, typename FuncT, typename... ParamsT, typename... BArgsT>
@@ -283,194 +790,230 @@ namespace DLG_Details
 		}
 	}
 
-	namespace Details
+	//* emplaceDel namespace. Same as _make but constructs the handler into caller owned storage.
+	namespace _emplace
 	{
-		namespace FunctionCasting
+		//* Fails to compile if a handler does not fit in a slot of the inplace delegate.
+		template<std::size_t SlotSize, typename HandlerT>
+		constexpr void assert_fits_slot()
 		{
-			template<typename RetT, typename... ParamsT>
-			const void* const void_cast(RetT(*func)(ParamsT...))
-			{
-				union {
-					RetT(*pf)(ParamsT...);
-					void* p;
-				};
-				pf = func;
-				return p;
-			}
-			
-			template<typename RetT, typename ClassT, typename... ParamsT>
-			const void* const void_cast(RetT(ClassT::*func)(ParamsT...))
-			{
-				union {
-					RetT(ClassT::*pf)(ParamsT...);
-					void* p;
-				};
-				pf = func;
-				return p;
-			}
-			
-			template<typename RetT, typename ClassT, typename... ParamsT>
-			const void* const void_cast(RetT(ClassT::*func)(ParamsT...) const)
-			{
-				union {
-					RetT(ClassT::*pf)(ParamsT...) const;
-					void* p;
-				};
-				pf = func;
-				return p;
-			}
+			static_assert(sizeof(HandlerT) <= SlotSize, "Bound handler is larger than the slot size of the inplace delegate. Increase SlotSize.\n");
+			static_assert(alignof(HandlerT) <= alignof(std::max_align_t), "Bound handler is over aligned for inplace storage.\n");
+		}
 
-			template<typename RetT, typename... ParamsT>
-			bool is_equal(RetT(*func1)(ParamsT...), const void* func2)
-			{
-				return (void_cast(func1) == func2);
-			}
+		//* Constructs delegate handler in 'mem' with split paramter pack.
+		template<std::size_t SlotSize, typename RetT, typename ClassT, typename FuncT, typename... ParamsT, typename... EArgsT, typename... BArgsT>
+		DelHandlerInterface<RetT>* _emplaceMemberDel_Impl(void* mem, const std::shared_ptr<ClassT>& target, FuncT func,
+			const std::tuple<ParamsT...>&, TypeGroup<EArgsT...>, const std::tuple<BArgsT...>& args)
+		{
+			using HandlerT = MemberDelHandler<TypeGroup<RetT, ClassT, FuncT, ParamsT...>, TypeGroup<EArgsT...>, TypeGroup<BArgsT...>>;
+			assert_fits_slot<SlotSize, HandlerT>();
+			return new (mem) HandlerT(target, func, args);
+		}
 
-			template<typename RetT, typename ClassT, typename... ParamsT>
-			bool is_equal(RetT(ClassT::*func1)(ParamsT...), const void* func2)
-			{
-				return (void_cast(func1) == func2);
-			}
+		//* Constructs delegate handler in 'mem' with split paramter pack.
+		template<std::size_t SlotSize, typename RetT, typename ClassT, typename FuncT, typename... ParamsT, typename... EArgsT, typename... BArgsT>
+		DelHandlerInterface<RetT>* _emplaceRawDel_Impl(void* mem, ClassT* const target, FuncT func,
+			const std::tuple<ParamsT...>&, TypeGroup<EArgsT...>, const std::tuple<BArgsT...>& args)
+		{
+			using HandlerT = RawDelHandler<TypeGroup<RetT, ClassT, FuncT, ParamsT...>, TypeGroup<EArgsT...>, TypeGroup<BArgsT...>>;
+			assert_fits_slot<SlotSize, HandlerT>();
+			return new (mem) HandlerT(target, func, args);
+		}
 
-			template<typename RetT, typename ClassT, typename... ParamsT>
-			bool is_equal(RetT(ClassT::*func1)(ParamsT...) const, const void* func2)
-			{
-				return (void_cast(func1) == func2);
-			}
-			//template<typename RetT, typename... ParamsT>
-			//bool is_equal(RetT(*func1)(ParamsT...), const std::size_t& func2)
-			//{
-			//	std::size_t s = typeid(RetT(*)(ParamsT...)).hash_code();
-			//	return (s == func2);
-			//}
-			//
-			//template<typename RetT, typename ClassT, typename... ParamsT>
-			//bool is_equal(RetT(ClassT::*func1)(ParamsT...), const std::size_t& func2)
-			//{
-			//	std::size_t s = typeid(RetT(ClassT::*)(ParamsT...)).hash_code();
-			//	return (s == func2);
-			//}
-			//
-			//template<typename RetT, typename ClassT, typename... ParamsT>
-			//bool is_equal(RetT(ClassT::*func1)(ParamsT...) const, const std::size_t& func2)
-			//{
-			//		std::size_t s = typeid(RetT(ClassT::*)(ParamsT...) const).hash_code();
-			//		return (s == func2);
-			//}
+		//* Constructs delegate handler in 'mem' with split paramter pack.
+		template<std::size_t SlotSize, typename RetT, typename FuncT, typename... ParamsT, typename... EArgsT, typename... BArgsT>
+		DelHandlerInterface<RetT>* _emplaceFreeDel_Impl(void* mem, FuncT func,
+			const std::tuple<ParamsT...>&, TypeGroup<EArgsT...>, const std::tuple<BArgsT...>& args)
+		{
+			using HandlerT = FreeDelHandler<TypeGroup<RetT, FuncT, ParamsT...>, TypeGroup<EArgsT...>, TypeGroup<BArgsT...>>;
+			assert_fits_slot<SlotSize, HandlerT>();
+			return new (mem) HandlerT(func, args);
 		}
+	}
 
-		namespace Traits
+	inline namespace _bind
+	{
+		//* Constructs delegate handler in 'mem'. 'mem' must hold at least SlotSize bytes aligned to max_align_t.
+		template<typename RetT, std::size_t SlotSize, typename ClassT, typename FuncT, typename... ParamsT, typename... BArgsT>
+		DelHandlerInterface<RetT>* emplace_MemberDel(void* mem, const std::shared_ptr<ClassT>& target, FuncT func,
+			const std::tuple<ParamsT...>& allTuple, const std::tuple<BArgsT...>& payLoad)
 		{
-			template<typename...> struct are_args_same;
+			return _emplace::_emplaceMemberDel_Impl<SlotSize, RetT>(mem, target, func, allTuple, _make::getArgs(allTuple, payLoad), payLoad);
+		}
 
-			//* Checks that T is a functor with specified types.
-			template <typename ReturnT, typename ClassT, typename... ArgsT>
-			struct is_Functor final
-			{
-			private:
-				struct BadType final {};
-				template <class U> static decltype(std::declval<U>().operator()(std::declval<ArgsT>()...)) Test(int);
-				template <class U> static BadType Test(...);
-			public:
-				static constexpr bool value = std::is_convertible<decltype(Test<ClassT>(0)), ReturnT>::value;
-			};
+		//* Constructs delegate handler in 'mem'. 'mem' must hold at least SlotSize bytes aligned to max_align_t.
+		template<typename RetT, std::size_t SlotSize, typename ClassT, typename FuncT, typename... ParamsT, typename... BArgsT>
+		DelHandlerInterface<RetT>* emplace_RawDel(void* mem, ClassT* target, FuncT func,
+			const std::tuple<ParamsT...>& allTuple, const std::tuple<BArgsT...>& payLoad)
+		{
+			return _emplace::_emplaceRawDel_Impl<SlotSize, RetT>(mem, target, func, allTuple, _make::getArgs(allTuple, payLoad), payLoad);
+		}
 
-			//* Checks that two parameter packs are equal.
-			template<template<typename...> typename TypeGrouping, typename... As, typename... Bs>
-			struct are_args_same<TypeGrouping<As...>, TypeGrouping<Bs...>> final
-			{
-			private:
-				template <typename, typename> struct ArgCheck final : std::false_type {};
-				template<> struct ArgCheck<TypeGroup<>, TypeGroup<>> final : std::true_type {};
+		//* Constructs delegate handler in 'mem'. 'mem' must hold at least SlotSize bytes aligned to max_align_t.
+		template<typename RetT, std::size_t SlotSize, typename FuncT, typename... ParamsT, typename... BArgsT>
+		DelHandlerInterface<RetT>* emplace_FreeDel(void* mem, FuncT func,
+			const std::tuple<ParamsT...>& allTuple, const std::tuple<BArgsT...>& payLoad)
+		{
+			return _emplace::_emplaceFreeDel_Impl<SlotSize, RetT>(mem, func, allTuple, _make::getArgs(allTuple, payLoad), payLoad);
+		}
+	}
 
-				template <typename A, typename... As, typename B, typename... Bs>
-				struct ArgCheck<TypeGroup<A, As...>, TypeGroup<B, Bs...>> final
-					: std::integral_constant<bool, std::is_same<A, B>::value
-					&& ArgCheck<TypeGroup<As...>, TypeGroup<Bs...>>::value> {};
-			public:
-				static constexpr bool value = ArgCheck<TypeGroup<As...>, TypeGroup<Bs...>>::value;
-			};
+	//* Intrusive list node resumed by the next Broadcast. Lives in the waiter's own storage, e.g. a coroutine frame.
+	template <typename... ParamsT>
+	struct BroadcastWaiter
+	{
+		BroadcastWaiter* NextWaiter = nullptr;
+		BroadcastWaiter** Link = nullptr; //pointer that references this node, nullptr when not listed.
 
-			//* Checks that two parameter packs are equal.
-			template<typename... As, typename... Bs>
-			void assert_packs_same(const std::tuple<As...>&, const std::tuple<Bs...>&)
-			{
-				static_assert(Details::Traits::are_args_same<TypeGroup<As...>, TypeGroup<Bs...>>::value,
-					"Argument types do not match function signature.");
-			}
+		virtual void Notify(const ParamsT&... in) = 0;
 
-			template<typename... As, typename... Bs>
-			void assert_size_gt(const std::tuple<As...>& params, const std::tuple<Bs...>& args)
+		void Delist()
+		{
+			if (this->Link != nullptr)
 			{
-				static_assert(sizeof...(As) >= sizeof...(Bs), "To many arguements in Bind"); 
+				*this->Link = this->NextWaiter;
+				if (this->NextWaiter != nullptr)
+				{
+					this->NextWaiter->Link = this->Link;
+				}
+				this->Link = nullptr;
+				this->NextWaiter = nullptr;
 			}
 		}
 
-		namespace TupleDetails
+	protected:
+		~BroadcastWaiter()
 		{
-			//* Take_front helper.
-			template <typename... ParamsT, size_t... I>
-			constexpr decltype(auto) take_front_impl(const std::tuple<ParamsT...>& t, const std::index_sequence<I...>&)
-			{
-				return std::make_tuple(std::get<I>(t)...);
-			}
+			Delist();
+		}
+	};
 
-			//* Creates a tuple with 'Trim' less arguements.
-			template <size_t Trim, typename... ParamsT>
-			constexpr decltype(auto) take_front(const std::tuple<ParamsT...>& t)
-			{
-				return take_front_impl(t, std::make_index_sequence<sizeof...(ParamsT) - Trim>());
-			}
-			//------------------------------------------
+	//* Waiters of a delegate. Each waiter is notified by one Broadcast, then removed.
+	template <typename... ParamsT>
+	class WaiterList final
+	{
+	private:
+		BroadcastWaiter<ParamsT...>* Head = nullptr;
 
-			//* Apply free function helper.
-			template <typename FreeFunc, typename... ParamsT, size_t... I>
-			constexpr decltype(auto) apply_impl(const FreeFunc& f, const std::tuple<ParamsT...>& t, const std::index_sequence<I...>&)
-			{
-				return f(std::get<I>(t)...);
-			}
+	public:
+		WaiterList() {}
+		//* A copied delegate does not inherit the waiters.
+		WaiterList(const WaiterList&) {}
+		WaiterList& operator=(const WaiterList&) { return *this; }
 
-			//* Calls free function with decupled tuple args.  
-			template <typename FreeFunc, typename... ParamsT>
-			constexpr decltype(auto) apply(const FreeFunc& f, const std::tuple<ParamsT...>& t)
+		//* Orphans remaining waiters; they are never notified.
+		~WaiterList()
+		{
+			while (this->Head != nullptr)
 			{
-				return apply_impl(f, t, std::make_index_sequence<sizeof...(ParamsT)>());
+				this->Head->Delist();
 			}
-			//------------------------------------------
+		}
+
+		bool IsEmpty() const
+		{
+			return this->Head == nullptr;
+		}
 
-			//* Apply member function helper.
-			template <typename ClassT, typename FreeFunc, typename... ParamsT, size_t... I>
-			constexpr decltype(auto) apply_impl(ClassT obj, const FreeFunc& f, const std::tuple<ParamsT...>& t, const std::index_sequence<I...>&)
+		void Enlist(BroadcastWaiter<ParamsT...>& waiter)
+		{
+			waiter.NextWaiter = this->Head;
+			if (this->Head != nullptr)
 			{
-				return (obj.*f)(std::get<I>(t)...);
+				this->Head->Link = &waiter.NextWaiter;
 			}
+			this->Head = &waiter;
+			waiter.Link = &this->Head;
+		}
 
-			//* Calls member function with decupled tuple args.  
-			template <typename ClassT, typename FuncT, typename... ParamsT>
-			constexpr decltype(auto) apply(ClassT obj, const FuncT& f, const std::tuple<ParamsT...>& t)
+		//* Notifies every listed waiter. Waiters enlisting while notified wait for the next Broadcast.
+		//* Broadcasts that pass payload bound arguement counts leave waiters listed.
+		template <typename... ArgsT>
+		void NotifyAll(const ArgsT&... in)
+		{
+			if constexpr (sizeof...(ArgsT) == sizeof...(ParamsT))
 			{
-				return apply_impl(obj, f, t, std::make_index_sequence<sizeof...(ParamsT)>());
+				//move the waiters to a local list, so waiters destroyed while others resume still delist safely.
+				BroadcastWaiter<ParamsT...>* pending = this->Head;
+				this->Head = nullptr;
+				if (pending != nullptr)
+				{
+					pending->Link = &pending;
+				}
+				while (pending != nullptr)
+				{
+					BroadcastWaiter<ParamsT...>* waiter = pending;
+					waiter->Delist();
+					waiter->Notify(in...);
+				}
 			}
-			//------------------------------------------
+		}
+	};
 
-			//* Apply member function helper.
-			template <typename ClassT, typename FreeFunc, typename... ParamsT, size_t... I>
-			constexpr decltype(auto) apply_impl(ClassT* obj, const FreeFunc& f, const std::tuple<ParamsT...>& t, const std::index_sequence<I...>&)
+	//* Fixed capacity handler storage. Never allocates; handlers are constructed in place and destroyed in place.
+	template <typename RetT, std::size_t Capacity, std::size_t SlotSize>
+	class InplaceHandlerPool final
+	{
+	private:
+		struct alignas(std::max_align_t) Slot
+		{
+			unsigned char Bytes[SlotSize];
+		};
+
+		Slot Slots[Capacity];
+		std::size_t FreeSlots[Capacity];
+		std::size_t FreeCount;
+
+	public:
+		InplaceHandlerPool() : FreeCount(Capacity)
+		{
+			static_assert(Capacity > 0, "Inplace delegate capacity must be greater than zero.\n");
+			for (std::size_t i = 0; i < Capacity; ++i)
 			{
-				return ((*obj).*f)(std::get<I>(t)...);
+				this->FreeSlots[i] = Capacity - 1 - i;
 			}
+		}
 
-			//* Calls member function with decupled tuple args.  
-			template <typename ClassT, typename FuncT, typename... ParamsT>
-			constexpr decltype(auto) apply(ClassT* obj, const FuncT& f, const std::tuple<ParamsT...>& t)
+		InplaceHandlerPool(const InplaceHandlerPool&) = delete;
+		InplaceHandlerPool& operator=(const InplaceHandlerPool&) = delete;
+
+		bool IsFull() const
+		{
+			return this->FreeCount == 0;
+		}
+
+		//* Slot the next Acquire() returns. Construct the handler there first, then Acquire(),
+		//* so a throwing constructor leaves the pool untouched. The pool must not be full.
+		std::size_t NextFree() const
+		{
+			assert(this->FreeCount > 0);
+			return this->FreeSlots[this->FreeCount - 1];
+		}
+
+		//* Reserves a slot. Returns the slot index; the pool must not be full.
+		std::size_t Acquire()
+		{
+			assert(this->FreeCount > 0);
+			return this->FreeSlots[--this->FreeCount];
+		}
+
+		void* SlotMemory(std::size_t slot)
+		{
+			return static_cast<void*>(this->Slots[slot].Bytes);
+		}
+
+		//* Destroys the handler living in 'slot' and returns the slot to the pool.
+		void Release(std::size_t slot, DelHandlerInterface<RetT>* handler)
+		{
+			if (handler != nullptr)
 			{
-				return apply_impl(obj, f, t, std::make_index_sequence<sizeof...(ParamsT)>());
+				handler->~DelHandlerInterface<RetT>();
 			}
+			this->FreeSlots[this->FreeCount++] = slot;
 		}
+	};
 
-		using namespace FunctionCasting;
-		using namespace TupleDetails;
-	}
 }
 
 #endif // !_DelDets_
@@ -0,0 +1,161 @@
+#pragma once
+#ifndef _DelEpoch_
+#define _DelEpoch_
+#include "DelegateDetails.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+namespace DLG_Details
+{
+	//* Epoch based reclamation. Readers publish the epoch they entered at; a handler retired at epoch E
+	//* is freed once every reader inside a critical section entered after E.
+	//* One domain serves every concurrent and sharded delegate of the process.
+	class EpochDomain
+	{
+	public:
+		//* Per thread reader slot, on its own cache line since its thread writes it on every Execute() or Broadcast().
+		//* Slots are reused by later threads and never freed.
+		struct alignas(DLG_CACHE_LINE_SIZE) Record
+		{
+			std::atomic<std::uint64_t> Active{ 0 }; //entered epoch, 0 outside a critical section.
+			std::atomic<bool> InUse{ false };
+			Record* Next = nullptr;
+			unsigned Depth = 0; //nested critical sections, owning thread only.
+		};
+
+	private:
+		std::atomic<std::uint64_t> Global{ 1 };
+		std::atomic<Record*> Head{ nullptr };
+
+		struct LocalRecord
+		{
+			Record* Slot = nullptr;
+
+			~LocalRecord()
+			{
+				if (this->Slot != nullptr)
+				{
+					this->Slot->InUse.store(false, std::memory_order_release);
+				}
+			}
+		};
+
+		Record* Acquire()
+		{
+			for (Record* record = this->Head.load(std::memory_order_acquire); record != nullptr; record = record->Next)
+			{
+				bool expected = false;
+				if (record->InUse.load(std::memory_order_relaxed) == false
+					&& record->InUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+				{
+					return record;
+				}
+			}
+
+			Record* record = new Record();
+			record->InUse.store(true, std::memory_order_relaxed);
+			record->Next = this->Head.load(std::memory_order_relaxed);
+			while (this->Head.compare_exchange_weak(record->Next, record, std::memory_order_release, std::memory_order_relaxed) == false) {}
+			return record;
+		}
+
+	public:
+		static EpochDomain& Instance()
+		{
+			static EpochDomain domain;
+			return domain;
+		}
+
+		Record& Local()
+		{
+			thread_local LocalRecord local;
+			if (local.Slot == nullptr)
+			{
+				local.Slot = Acquire();
+			}
+			return *local.Slot;
+		}
+
+		void Enter(Record& record)
+		{
+			if (record.Depth++ == 0)
+			{
+				record.Active.store(this->Global.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+			}
+		}
+
+		void Exit(Record& record)
+		{
+			if (--record.Depth == 0)
+			{
+				record.Active.store(0, std::memory_order_release);
+			}
+		}
+
+		//* Call after unlinking a handler.
+		//@Return: Epoch to retire the handler at.
+		std::uint64_t Advance()
+		{
+			return this->Global.fetch_add(1, std::memory_order_seq_cst);
+		}
+
+		//@Return: Oldest epoch a reader is inside, max value if none is.
+		std::uint64_t OldestActive() const
+		{
+			std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+			for (Record* record = this->Head.load(std::memory_order_acquire); record != nullptr; record = record->Next)
+			{
+				const std::uint64_t active = record->Active.load(std::memory_order_seq_cst);
+				if (active != 0 && active < oldest)
+				{
+					oldest = active;
+				}
+			}
+			return oldest;
+		}
+
+		//* Waits until every reader that entered before the call has left. Returns at once when the calling
+		//* thread is a reader itself, it would wait for itself.
+		//@Return: False, if it returned without waiting.
+		bool Synchronize()
+		{
+			if (Local().Depth > 0)
+			{
+				return false;
+			}
+			const std::uint64_t epoch = Advance();
+			while (OldestActive() <= epoch)
+			{
+				std::this_thread::yield();
+			}
+			return true;
+		}
+	};
+
+	//* Keeps handlers loaded inside its scope alive.
+	class EpochGuard
+	{
+	private:
+		EpochDomain& Domain;
+		EpochDomain::Record& Slot;
+
+	public:
+		EpochGuard() : Domain(EpochDomain::Instance()), Slot(Domain.Local())
+		{
+			this->Domain.Enter(this->Slot);
+		}
+
+		~EpochGuard()
+		{
+			this->Domain.Exit(this->Slot);
+		}
+
+		EpochGuard(const EpochGuard&) = delete;
+		EpochGuard& operator=(const EpochGuard&) = delete;
+	};
+}
+
+#endif // !_DelEpoch_
@@ -0,0 +1,355 @@
+#pragma once
+#ifndef _DelInstrumentation_
+#define _DelInstrumentation_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+
+//* Define DLG_INSTRUMENTATION before including Delegates.h to record per delegate statistics.
+//* When it is not defined the delegates carry no statistics and no timing code is compiled.
+
+namespace DLG_Instrumentation
+{
+	//* Monotonic time in nanoseconds.
+	inline std::uint64_t Now()
+	{
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	//* Listeners slower than this are reported as slow. Defaults to 1ms.
+	inline std::atomic<std::uint64_t>& SlowListenerBudgetNs()
+	{
+		static std::atomic<std::uint64_t> budget(1000000);
+		return budget;
+	}
+
+	//* Lock free log linear histogram of nanosecond values.
+	//* Every power of two is split into 8 buckets, keeping the relative error under 12.5%.
+	class LatencyHistogram final
+	{
+	public:
+		static constexpr unsigned SubBucketBits = 3;
+		static constexpr unsigned SubBuckets = 1u << SubBucketBits;
+		static constexpr unsigned BucketCount = (64 - SubBucketBits + 1) * SubBuckets;
+
+	private:
+		std::atomic<std::uint64_t> Buckets[BucketCount];
+		std::atomic<std::uint64_t> Total;
+		std::atomic<std::uint64_t> Max;
+
+		static unsigned MostSignificantBit(std::uint64_t v)
+		{
+			unsigned msb = 0;
+			if (v >> 32) { v >>= 32; msb += 32; }
+			if (v >> 16) { v >>= 16; msb += 16; }
+			if (v >> 8) { v >>= 8; msb += 8; }
+			if (v >> 4) { v >>= 4; msb += 4; }
+			if (v >> 2) { v >>= 2; msb += 2; }
+			if (v >> 1) { msb += 1; }
+			return msb;
+		}
+
+	public:
+		LatencyHistogram()
+		{
+			Reset();
+		}
+
+		LatencyHistogram(const LatencyHistogram&) = delete;
+		LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+		static unsigned BucketIndex(std::uint64_t ns)
+		{
+			if (ns < SubBuckets)
+			{
+				return static_cast<unsigned>(ns);
+			}
+			const unsigned msb = MostSignificantBit(ns);
+			const unsigned shift = msb - SubBucketBits;
+			return ((msb - SubBucketBits + 1) << SubBucketBits) + static_cast<unsigned>((ns >> shift) & (SubBuckets - 1));
+		}
+
+		//* Smallest value that lands in bucket 'index'.
+		static std::uint64_t BucketLowerBound(unsigned index)
+		{
+			if (index < SubBuckets)
+			{
+				return index;
+			}
+			const unsigned msb = (index >> SubBucketBits) + SubBucketBits - 1;
+			const std::uint64_t sub = index & (SubBuckets - 1);
+			return (SubBuckets + sub) << (msb - SubBucketBits);
+		}
+
+		void Record(std::uint64_t ns)
+		{
+			this->Buckets[BucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+			this->Total.fetch_add(1, std::memory_order_relaxed);
+
+			std::uint64_t max = this->Max.load(std::memory_order_relaxed);
+			while (ns > max && !this->Max.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {}
+		}
+
+		std::uint64_t Count() const
+		{
+			return this->Total.load(std::memory_order_relaxed);
+		}
+
+		//* Adds the samples of 'other', e.g. to combine per thread histograms.
+		void Merge(const LatencyHistogram& other)
+		{
+			for (unsigned i = 0; i < BucketCount; ++i)
+			{
+				this->Buckets[i].fetch_add(other.Buckets[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+			this->Total.fetch_add(other.Count(), std::memory_order_relaxed);
+
+			const std::uint64_t ns = other.MaxValue();
+			std::uint64_t max = this->Max.load(std::memory_order_relaxed);
+			while (ns > max && !this->Max.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {}
+		}
+
+		std::uint64_t MaxValue() const
+		{
+			return this->Max.load(std::memory_order_relaxed);
+		}
+
+		//* Value at 'percentile' (0-100). Approximate, reports the lower bound of the matching bucket.
+		std::uint64_t Percentile(double percentile) const
+		{
+			const std::uint64_t total = Count();
+			if (total == 0)
+			{
+				return 0;
+			}
+			std::uint64_t rank = static_cast<std::uint64_t>(percentile / 100.0 * static_cast<double>(total));
+			rank = (rank == 0) ? 1 : (rank > total ? total : rank);
+
+			std::uint64_t seen = 0;
+			for (unsigned i = 0; i < BucketCount; ++i)
+			{
+				seen += this->Buckets[i].load(std::memory_order_relaxed);
+				if (seen >= rank)
+				{
+					return BucketLowerBound(i);
+				}
+			}
+			return MaxValue();
+		}
+
+		void Reset()
+		{
+			for (auto& bucket : this->Buckets)
+			{
+				bucket.store(0, std::memory_order_relaxed);
+			}
+			this->Total.store(0, std::memory_order_relaxed);
+			this->Max.store(0, std::memory_order_relaxed);
+		}
+	};
+
+	//* A listener that took longer than SlowListenerBudgetNs().
+	struct SlowListener
+	{
+		std::atomic<const void*> Object;
+		std::atomic<const void*> Function;
+		std::atomic<std::uint64_t> Nanoseconds;
+	};
+
+	class StatsRegistry;
+
+	//* Statistics owned by a single delegate. Registers itself in the StatsRegistry for its lifetime.
+	class DelegateStats final
+	{
+	public:
+		static constexpr unsigned SlowListenerCapacity = 8;
+
+	private:
+		friend class StatsRegistry;
+		DelegateStats* Prev;
+		DelegateStats* Next;
+
+		const char* Name;
+		std::atomic<std::uint64_t> Broadcasts;
+		std::atomic<std::uint64_t> Invokes;
+		std::atomic<std::uint64_t> Listeners;
+		std::atomic<std::uint64_t> SlowCount;
+		LatencyHistogram BroadcastLatency;
+		LatencyHistogram ListenerLatency;
+		SlowListener Slow[SlowListenerCapacity];
+
+	public:
+		inline DelegateStats();
+		inline DelegateStats(const DelegateStats& other);
+		inline ~DelegateStats();
+		DelegateStats& operator=(const DelegateStats&) { return *this; }
+
+		void SetName(const char* name) { this->Name = name; }
+		const char* GetName() const { return this->Name; }
+
+		std::uint64_t BroadcastCount() const { return this->Broadcasts.load(std::memory_order_relaxed); }
+		std::uint64_t InvokeCount() const { return this->Invokes.load(std::memory_order_relaxed); }
+		std::uint64_t ListenerCount() const { return this->Listeners.load(std::memory_order_relaxed); }
+		std::uint64_t SlowListenerCount() const { return this->SlowCount.load(std::memory_order_relaxed); }
+		const LatencyHistogram& GetBroadcastLatency() const { return this->BroadcastLatency; }
+		const LatencyHistogram& GetListenerLatency() const { return this->ListenerLatency; }
+
+		//* Called once per Broadcast/Execute.
+		void RecordBroadcast(std::size_t listeners, std::uint64_t ns)
+		{
+			this->Broadcasts.fetch_add(1, std::memory_order_relaxed);
+			this->Listeners.store(listeners, std::memory_order_relaxed);
+			this->BroadcastLatency.Record(ns);
+		}
+
+		//* Called once per listener invoke. Identifies slow listeners by object and function pointer.
+		void RecordInvoke(const void* object, const void* function, std::uint64_t ns)
+		{
+			this->Invokes.fetch_add(1, std::memory_order_relaxed);
+			this->ListenerLatency.Record(ns);
+			if (ns > SlowListenerBudgetNs().load(std::memory_order_relaxed))
+			{
+				SlowListener& slow = this->Slow[this->SlowCount.fetch_add(1, std::memory_order_relaxed) % SlowListenerCapacity];
+				slow.Object.store(object, std::memory_order_relaxed);
+				slow.Function.store(function, std::memory_order_relaxed);
+				slow.Nanoseconds.store(ns, std::memory_order_relaxed);
+			}
+		}
+
+		void Reset()
+		{
+			this->Broadcasts.store(0, std::memory_order_relaxed);
+			this->Invokes.store(0, std::memory_order_relaxed);
+			this->SlowCount.store(0, std::memory_order_relaxed);
+			this->BroadcastLatency.Reset();
+			this->ListenerLatency.Reset();
+		}
+
+		//* Writes a one delegate summary, followed by the most recent slow listeners.
+		void Dump(std::ostream& out) const
+		{
+			out << (this->Name != nullptr ? this->Name : "<unnamed>") << " [" << static_cast<const void*>(this) << "]"
+				<< " broadcasts=" << BroadcastCount()
+				<< " invokes=" << InvokeCount()
+				<< " listeners=" << ListenerCount()
+				<< " broadcast_ns(p50/p99/max)=" << this->BroadcastLatency.Percentile(50) << "/" << this->BroadcastLatency.Percentile(99) << "/" << this->BroadcastLatency.MaxValue()
+				<< " listener_ns(p50/p99/max)=" << this->ListenerLatency.Percentile(50) << "/" << this->ListenerLatency.Percentile(99) << "/" << this->ListenerLatency.MaxValue()
+				<< " slow=" << SlowListenerCount() << "\n";
+
+			const std::uint64_t slowCount = SlowListenerCount();
+			const std::uint64_t shown = slowCount < SlowListenerCapacity ? slowCount : SlowListenerCapacity;
+			for (std::uint64_t i = 0; i < shown; ++i)
+			{
+				const SlowListener& slow = this->Slow[(slowCount - 1 - i) % SlowListenerCapacity];
+				out << "    slow listener object=" << slow.Object.load(std::memory_order_relaxed)
+					<< " function=" << slow.Function.load(std::memory_order_relaxed)
+					<< " ns=" << slow.Nanoseconds.load(std::memory_order_relaxed) << "\n";
+			}
+		}
+	};
+
+	//* Process wide list of every live DelegateStats.
+	//* Registration takes a lock; recording statistics never does.
+	class StatsRegistry final
+	{
+	private:
+		std::mutex Lock;
+		DelegateStats* Head;
+
+		StatsRegistry() : Head(nullptr) {}
+
+	public:
+		static StatsRegistry& Get()
+		{
+			static StatsRegistry registry;
+			return registry;
+		}
+
+		void Register(DelegateStats* stats)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			stats->Prev = nullptr;
+			stats->Next = this->Head;
+			if (this->Head != nullptr)
+			{
+				this->Head->Prev = stats;
+			}
+			this->Head = stats;
+		}
+
+		void Unregister(DelegateStats* stats)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			if (stats->Prev != nullptr)
+			{
+				stats->Prev->Next = stats->Next;
+			}
+			else
+			{
+				this->Head = stats->Next;
+			}
+			if (stats->Next != nullptr)
+			{
+				stats->Next->Prev = stats->Prev;
+			}
+			stats->Prev = stats->Next = nullptr;
+		}
+
+		//* Calls func(const DelegateStats&) for every registered delegate.
+		template <typename FuncT>
+		void ForEach(FuncT func)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			for (const DelegateStats* stats = this->Head; stats != nullptr; stats = stats->Next)
+			{
+				func(*stats);
+			}
+		}
+
+		//* Writes the statistics of every registered delegate.
+		void Dump(std::ostream& out)
+		{
+			ForEach([&out](const DelegateStats& stats) { stats.Dump(out); });
+		}
+
+		void ResetAll()
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			for (DelegateStats* stats = this->Head; stats != nullptr; stats = stats->Next)
+			{
+				stats->Reset();
+			}
+		}
+	};
+
+	DelegateStats::DelegateStats()
+		: Prev(nullptr), Next(nullptr), Name(nullptr)
+		, Broadcasts(0), Invokes(0), Listeners(0), SlowCount(0)
+	{
+		StatsRegistry::Get().Register(this);
+	}
+
+	//* Copies only the name; a copied delegate starts with empty statistics.
+	DelegateStats::DelegateStats(const DelegateStats& other)
+		: DelegateStats()
+	{
+		this->Name = other.Name;
+	}
+
+	DelegateStats::~DelegateStats()
+	{
+		StatsRegistry::Get().Unregister(this);
+	}
+
+	//* Writes the statistics of every live delegate.
+	inline void DumpAll(std::ostream& out)
+	{
+		StatsRegistry::Get().Dump(out);
+	}
+}
+
+#endif // !_DelInstrumentation_
@@ -0,0 +1,282 @@
+#pragma once
+#ifndef _DelMailbox_
+#define _DelMailbox_
+#include "Delegates.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+namespace DLG
+{
+	//* Work posted to a ThreadMailbox.
+	struct MailboxTask
+	{
+		std::atomic<MailboxTask*> Next;
+
+		MailboxTask() : Next(nullptr) {}
+		virtual ~MailboxTask() {}
+		virtual void Run() {}
+
+		//* Runs then frees the task. Tasks not owned by the mailbox override this and Release().
+		virtual void Invoke()
+		{
+			Run();
+			delete this;
+		}
+
+		//* Frees the task without running it, when the mailbox is destroyed.
+		virtual void Release() { delete this; }
+	};
+
+	//* Lock free multi producer, single consumer queue of tasks owned by one thread.
+	//* Any thread may Post(); only the owning thread may Pump().
+	class ThreadMailbox final
+	{
+	public:
+		using Ptr = std::shared_ptr<ThreadMailbox>;
+
+	private:
+		std::atomic<MailboxTask*> Head; //producers push here.
+		MailboxTask* Tail;              //consumer pops here.
+		MailboxTask Stub;
+		std::atomic<std::thread::id> Owner;
+
+		void Push(MailboxTask* task)
+		{
+			task->Next.store(nullptr, std::memory_order_relaxed);
+			MailboxTask* prev = this->Head.exchange(task, std::memory_order_acq_rel);
+			prev->Next.store(task, std::memory_order_release);
+		}
+
+		//* Returns nullptr when empty, or when a producer is midway through Push().
+		MailboxTask* Pop()
+		{
+			MailboxTask* tail = this->Tail;
+			MailboxTask* next = tail->Next.load(std::memory_order_acquire);
+			if (tail == &this->Stub)
+			{
+				if (next == nullptr)
+				{
+					return nullptr;
+				}
+				this->Tail = next;
+				tail = next;
+				next = next->Next.load(std::memory_order_acquire);
+			}
+			if (next != nullptr)
+			{
+				this->Tail = next;
+				return tail;
+			}
+			if (tail != this->Head.load(std::memory_order_acquire))
+			{
+				return nullptr;
+			}
+			Push(&this->Stub);
+			next = tail->Next.load(std::memory_order_acquire);
+			if (next != nullptr)
+			{
+				this->Tail = next;
+				return tail;
+			}
+			return nullptr;
+		}
+
+	public:
+		ThreadMailbox() : Head(&Stub), Tail(&Stub), Owner(std::thread::id()) {}
+
+		ThreadMailbox(const ThreadMailbox&) = delete;
+		ThreadMailbox& operator=(const ThreadMailbox&) = delete;
+
+		//* Tasks that were never pumped are destroyed without running.
+		~ThreadMailbox()
+		{
+			while (MailboxTask* task = Pop())
+			{
+				task->Release();
+			}
+		}
+
+		//* Mailbox of the calling thread, created on first use.
+		static const Ptr& Current()
+		{
+			thread_local Ptr mailbox = Create(std::this_thread::get_id());
+			return mailbox;
+		}
+
+		//* Creates a mailbox owned by 'owner'. Use AttachToCurrentThread() to hand it to a thread later.
+		static Ptr Create(std::thread::id owner = std::thread::id())
+		{
+			Ptr mailbox = std::make_shared<ThreadMailbox>();
+			mailbox->Owner.store(owner, std::memory_order_relaxed);
+			return mailbox;
+		}
+
+		//* Makes the calling thread the owner; binds on this mailbox run inline on it from now on.
+		void AttachToCurrentThread()
+		{
+			this->Owner.store(std::this_thread::get_id(), std::memory_order_release);
+		}
+
+		bool IsOwnedByCurrentThread() const
+		{
+			return this->Owner.load(std::memory_order_acquire) == std::this_thread::get_id();
+		}
+
+		//* Takes ownership of 'task' until it is invoked. Safe from any thread.
+		void Post(MailboxTask* task)
+		{
+			Push(task);
+		}
+
+		//* Runs every posted task. Call from the owning thread only.
+		//@Return: Amount of tasks run.
+		int Pump()
+		{
+			int count = 0;
+			while (MailboxTask* task = Pop())
+			{
+				task->Invoke();
+				++count;
+			}
+			return count;
+		}
+	};
+
+	//* Runs listeners posted to the calling thread's mailbox.
+	//@Return: Amount of listeners run.
+	inline int PumpDelegates()
+	{
+		return ThreadMailbox::Current()->Pump();
+	}
+}
+
+namespace DLG_Details
+{
+	template<typename...> struct AffineDelHandler;
+
+	//* Posted invocation of a thread affine bind. Owns a copy of the broadcast arguements; every listener
+	//* posted by the same Broadcast gets its own task and copy. Skipped if the bind was removed after posting.
+	template<typename RetT, typename HandlerT, typename... EArgsT>
+	struct AffineTask final : public DLG::MailboxTask
+	{
+		std::shared_ptr<const HandlerT> Handler;
+		std::shared_ptr<const std::atomic<bool>> Cancelled;
+		std::tuple<EArgsT...> Args;
+
+		AffineTask(const std::shared_ptr<const HandlerT>& handler, const std::shared_ptr<const std::atomic<bool>>& cancelled, EArgsT... in)
+			: Handler(handler), Cancelled(cancelled), Args(std::move(in)...) {}
+
+		virtual void Run() override final
+		{
+			if (this->Cancelled->load(std::memory_order_acquire) == false && this->Handler->IsValid())
+			{
+				std::apply([this](EArgsT&... in) { this->Handler->Execute(std::move(in)...); }, this->Args);
+			}
+		}
+	};
+
+	//* Wraps a bound handler. Executes it inline on the mailbox owner's thread, and posts it to the mailbox otherwise.
+	//* Removing the bind (RemoveBind, Clear, pruning) destroys this handler, which cancels the tasks it posted,
+	//* so a raw target may be deleted right after RemoveBind. Removing from a thread other than the owner's
+	//* does not wait for a task the owner is already running.
+	template<template<typename...> typename TypeGrouping, typename RetT, typename... ParamsT, typename... EArgsT>
+	struct AffineDelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<EArgsT...>> final
+		: public DelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<EArgsT...>>
+	{
+	private:
+		using InnerT = DelHandler<TypeGrouping<RetT>, TypeGrouping<ParamsT...>, TypeGrouping<EArgsT...>>;
+
+		std::shared_ptr<const InnerT> Inner;
+		std::shared_ptr<std::atomic<bool>> Cancelled; //shared with posted tasks, set when the bind is removed.
+		DLG::ThreadMailbox::Ptr Mailbox;
+
+		//* DelHandler's destructor is protected, delete through the interface.
+		static void DeleteInner(const InnerT* inner)
+		{
+			delete static_cast<const DelHandlerInterface<RetT>*>(inner);
+		}
+
+	public:
+		AffineDelHandler(const DLG::ThreadMailbox::Ptr& mailbox, InnerT* inner)
+			: InnerT(), Inner(inner, &DeleteInner), Cancelled(std::make_shared<std::atomic<bool>>(false)), Mailbox(mailbox)
+		{
+			static_assert(std::is_void<RetT>::value, "Thread affine binds cannot return a value.\n");
+		}
+
+		virtual ~AffineDelHandler()
+		{
+			this->Cancelled->store(true, std::memory_order_release);
+		}
+
+		virtual RetT Execute(EArgsT... in) const override final
+		{
+			if (this->Mailbox->IsOwnedByCurrentThread())
+			{
+				this->Inner->Execute(std::move(in)...);
+			}
+			else
+			{
+				this->Mailbox->Post(new AffineTask<RetT, InnerT, EArgsT...>(this->Inner, this->Cancelled, std::move(in)...));
+			}
+		}
+
+		virtual bool IsValid() const override final
+		{
+			return this->Inner->IsValid();
+		}
+
+		virtual bool CanExpire() const override final
+		{
+			return this->Inner->CanExpire();
+		}
+
+		virtual const void* GetObjectPointer() const override final
+		{
+			return this->Inner->GetObjectPointer();
+		}
+
+		virtual const void* GetMemberFuncPointer() const override final
+		{
+			return this->Inner->GetMemberFuncPointer();
+		}
+
+		virtual std::size_t GetHandlerSize() const override final
+		{
+			return sizeof(*this) + this->Inner->GetHandlerSize();
+		}
+
+		virtual std::size_t GetPayloadSize() const override final
+		{
+			return this->Inner->GetPayloadSize();
+		}
+	};
+
+	namespace _make
+	{
+		//* Wraps 'inner' with the execution arg types split from the payload.
+		template<typename RetT, typename... ParamsT, typename... EArgsT>
+		DelHandlerInterface<RetT>* _makeAffineDel_Impl(const DLG::ThreadMailbox::Ptr& mailbox, DelHandlerInterface<RetT>* inner,
+			const std::tuple<ParamsT...>&, TypeGroup<EArgsT...>)
+		{
+			using HandlerT = DelHandler<TypeGroup<RetT>, TypeGroup<ParamsT...>, TypeGroup<EArgsT...>>;
+			return new AffineDelHandler<TypeGroup<RetT>, TypeGroup<ParamsT...>, TypeGroup<EArgsT...>>(mailbox, static_cast<HandlerT*>(inner));
+		}
+	}
+
+	inline namespace _bind
+	{
+		//* Wraps a handler made by make_MemberDel/make_RawDel/make_FreeDel so it runs on 'mailbox's thread.
+		template<typename RetT, typename... ParamsT, typename... BArgsT>
+		DelHandlerInterface<RetT>* make_AffineDel(const DLG::ThreadMailbox::Ptr& mailbox, DelHandlerInterface<RetT>* inner,
+			const std::tuple<ParamsT...>& allTuple, const std::tuple<BArgsT...>& payLoad)
+		{
+			return _make::_makeAffineDel_Impl<RetT>(mailbox, inner, allTuple, _make::getArgs(allTuple, payLoad));
+		}
+	}
+}
+
+#endif // !_DelMailbox_
@@ -0,0 +1,461 @@
+#pragma once
+#ifndef _DelScheduler_
+#define _DelScheduler_
+#include "Delegates.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace DLG_Details
+{
+	//* Deferred call owned by a DelegateScheduler timer.
+	struct TimerTask
+	{
+		virtual ~TimerTask() {}
+		virtual void Fire() = 0;
+	};
+
+	//* Calls the delegate with a copy of the scheduled arguements. Works for single and multicast delegates.
+	template<typename DelegateT, typename... ArgsT>
+	struct ScheduledCall final : public TimerTask
+	{
+		DelegateT* Delegate;
+		std::tuple<ArgsT...> Args;
+
+		ScheduledCall(DelegateT& delegate, ArgsT... in)
+			: Delegate(&delegate), Args(std::move(in)...) {}
+
+		template<std::size_t... I>
+		void _Fire(std::index_sequence<I...>)
+		{
+			(*this->Delegate)(std::get<I>(this->Args)...);
+		}
+
+		virtual void Fire() override final
+		{
+			_Fire(std::index_sequence_for<ArgsT...>());
+		}
+	};
+}
+
+namespace DLG
+{
+	//* Identifies a scheduled timer. Stays safe to cancel after the timer fired or was cancelled.
+	struct TimerToken
+	{
+		unsigned Index = ~0u;
+		unsigned Generation = 0;
+
+		bool IsValid() const
+		{
+			return this->Index != ~0u;
+		}
+	};
+
+	//* Fires delegates after a delay, or periodically, from a hierarchical timer wheel.
+	//* Scheduling and cancelling are constant time; a tick only visits the timers that expire in it
+	//* and, every 64 ticks, the timers moving down from a coarser wheel.
+	//* Drive it with Update() from a tick loop, AdvanceTicks() for a manual clock, or StartThread().
+	//* Safe to schedule and cancel from any thread, delegates included. Delegates fire on the driving thread
+	//* with no lock held, and must outlive their timers.
+	class DelegateScheduler final
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+	private:
+		static constexpr unsigned SlotBits = 6;
+		static constexpr unsigned SlotCount = 1u << SlotBits;
+		static constexpr unsigned SlotMask = SlotCount - 1;
+		static constexpr unsigned Levels = 4;
+		static constexpr std::uint64_t MaxDelta = (std::uint64_t(1) << (SlotBits * Levels)) - 1;
+		static constexpr int NONE = -1;
+
+		enum class TimerState : unsigned char { Free, Scheduled, Firing, CancelledWhileFiring };
+
+		struct Timer
+		{
+			std::unique_ptr<DLG_Details::TimerTask> Task;
+			std::uint64_t Expiry = 0;
+			std::uint64_t Period = 0; //in ticks, 0 fires once.
+			unsigned Generation = 0;
+			int Prev = NONE;
+			int Next = NONE; //also links the free list.
+			int Slot = NONE;
+			TimerState State = TimerState::Free;
+		};
+
+		std::vector<Timer> Timers;
+		int FreeList = NONE;
+		int Slots[Levels * SlotCount];
+		std::uint64_t Now = 0; //last processed tick.
+		unsigned ScheduledCount = 0;
+		std::vector<int> Expired; //reused between ticks.
+
+		Clock::duration Resolution;
+		Clock::time_point Origin;
+
+		mutable std::mutex Lock;
+		std::condition_variable Wake;
+		std::thread Worker;
+		bool Running = false;
+
+		//@Return: Index of a free timer.
+		int Allocate()
+		{
+			if (this->FreeList != NONE)
+			{
+				int index = this->FreeList;
+				this->FreeList = this->Timers[index].Next;
+				return index;
+			}
+			this->Timers.emplace_back();
+			return static_cast<int>(this->Timers.size() - 1);
+		}
+
+		void Deallocate(int index)
+		{
+			Timer& timer = this->Timers[index];
+			timer.Task.reset();
+			timer.State = TimerState::Free;
+			++timer.Generation;
+			timer.Next = this->FreeList;
+			this->FreeList = index;
+		}
+
+		//* Links the timer into the slot its expiry falls in, relative to Now.
+		void Insert(int index)
+		{
+			Timer& timer = this->Timers[index];
+			std::uint64_t delta = timer.Expiry > this->Now ? timer.Expiry - this->Now : 0;
+			std::uint64_t expiry = timer.Expiry;
+			if (delta > MaxDelta)
+			{
+				//parked in the coarsest wheel; reinserted from there until in range.
+				delta = MaxDelta;
+				expiry = this->Now + MaxDelta;
+			}
+			unsigned level = 0;
+			while (level + 1 < Levels && delta >= (std::uint64_t(1) << (SlotBits * (level + 1))))
+			{
+				++level;
+			}
+			const int slot = static_cast<int>(level * SlotCount + ((expiry >> (SlotBits * level)) & SlotMask));
+
+			timer.Slot = slot;
+			timer.Prev = NONE;
+			timer.Next = this->Slots[slot];
+			if (timer.Next != NONE)
+			{
+				this->Timers[timer.Next].Prev = index;
+			}
+			this->Slots[slot] = index;
+		}
+
+		void Unlink(int index)
+		{
+			Timer& timer = this->Timers[index];
+			if (timer.Prev != NONE)
+			{
+				this->Timers[timer.Prev].Next = timer.Next;
+			}
+			else
+			{
+				this->Slots[timer.Slot] = timer.Next;
+			}
+			if (timer.Next != NONE)
+			{
+				this->Timers[timer.Next].Prev = timer.Prev;
+			}
+			timer.Prev = timer.Next = timer.Slot = NONE;
+		}
+
+		//* Moves every timer of a coarse slot down to the finer wheels.
+		void Cascade(unsigned level, unsigned index)
+		{
+			const int slot = static_cast<int>(level * SlotCount + index);
+			int current = this->Slots[slot];
+			this->Slots[slot] = NONE;
+			while (current != NONE)
+			{
+				int next = this->Timers[current].Next;
+				Insert(current);
+				current = next;
+			}
+		}
+
+		//* Advances one tick and collects the expired timers into Expired.
+		void Step()
+		{
+			++this->Now;
+			for (unsigned level = 1; level < Levels; ++level)
+			{
+				if ((this->Now & ((std::uint64_t(1) << (SlotBits * level)) - 1)) != 0)
+				{
+					break;
+				}
+				Cascade(level, static_cast<unsigned>((this->Now >> (SlotBits * level)) & SlotMask));
+			}
+
+			const int slot = static_cast<int>(this->Now & SlotMask);
+			int current = this->Slots[slot];
+			this->Slots[slot] = NONE;
+			while (current != NONE)
+			{
+				Timer& timer = this->Timers[current];
+				int next = timer.Next;
+				timer.Prev = timer.Next = timer.Slot = NONE;
+				timer.State = TimerState::Firing;
+				this->Expired.push_back(current);
+				current = next;
+			}
+		}
+
+		//* Runs the tasks collected by Step() without the lock held, then reschedules or frees them.
+		void FireExpired(std::unique_lock<std::mutex>& guard)
+		{
+			if (this->Expired.empty())
+			{
+				return;
+			}
+			std::vector<int> expired;
+			expired.swap(this->Expired);
+			std::vector<DLG_Details::TimerTask*> tasks;
+			tasks.reserve(expired.size());
+			for (int index : expired)
+			{
+				tasks.push_back(this->Timers[index].Task.get());
+			}
+
+			guard.unlock();
+			for (DLG_Details::TimerTask* task : tasks)
+			{
+				task->Fire();
+			}
+			guard.lock();
+
+			for (int index : expired)
+			{
+				Timer& timer = this->Timers[index];
+				if (timer.State == TimerState::Firing && timer.Period != 0)
+				{
+					timer.State = TimerState::Scheduled;
+					timer.Expiry = this->Now + timer.Period;
+					Insert(index);
+				}
+				else
+				{
+					--this->ScheduledCount;
+					Deallocate(index);
+				}
+			}
+			expired.clear();
+			if (this->Expired.empty())
+			{
+				this->Expired.swap(expired); //keep the capacity.
+			}
+		}
+
+		std::uint64_t ToTicks(Clock::duration delay) const
+		{
+			if (delay <= Clock::duration::zero())
+			{
+				return 1;
+			}
+			std::uint64_t ticks = static_cast<std::uint64_t>((delay + this->Resolution - Clock::duration(1)) / this->Resolution);
+			return ticks == 0 ? 1 : ticks;
+		}
+
+		TimerToken Schedule(DLG_Details::TimerTask* task, std::uint64_t delay, std::uint64_t period)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			int index = Allocate();
+			Timer& timer = this->Timers[index];
+			timer.Task.reset(task);
+			timer.Expiry = this->Now + delay;
+			timer.Period = period;
+			timer.State = TimerState::Scheduled;
+			Insert(index);
+			++this->ScheduledCount;
+
+			TimerToken token;
+			token.Index = static_cast<unsigned>(index);
+			token.Generation = timer.Generation;
+			return token;
+		}
+
+		//* Processes ticks up to 'target'. Skips straight to it while no timer is scheduled.
+		void AdvanceTo(std::uint64_t target)
+		{
+			std::unique_lock<std::mutex> guard(this->Lock);
+			while (this->Now < target)
+			{
+				if (this->ScheduledCount == 0)
+				{
+					//nothing to cascade or fire on the way.
+					this->Now = target;
+					break;
+				}
+				Step();
+				FireExpired(guard);
+			}
+		}
+
+	public:
+		//* 'resolution' is the length of a tick. Delays are rounded up to whole ticks.
+		explicit DelegateScheduler(Clock::duration resolution = std::chrono::milliseconds(1))
+			: Resolution(resolution > Clock::duration::zero() ? resolution : Clock::duration(1)), Origin(Clock::now())
+		{
+			for (int& slot : this->Slots)
+			{
+				slot = NONE;
+			}
+		}
+
+		DelegateScheduler(const DelegateScheduler&) = delete;
+		DelegateScheduler& operator=(const DelegateScheduler&) = delete;
+
+		//* Pending timers are dropped without firing.
+		~DelegateScheduler()
+		{
+			StopThread();
+		}
+
+		//* Fires 'delegate' with 'in' once, after 'delay'.
+		template<typename RepT, typename PeriodT, typename DelegateT, typename... ArgsT>
+		TimerToken ScheduleAfter(std::chrono::duration<RepT, PeriodT> delay, DelegateT& delegate, ArgsT... in)
+		{
+			return Schedule(new DLG_Details::ScheduledCall<DelegateT, ArgsT...>(delegate, std::move(in)...),
+				ToTicks(std::chrono::duration_cast<Clock::duration>(delay)), 0);
+		}
+
+		//* Fires 'delegate' with 'in' every 'period', starting one period from now.
+		template<typename RepT, typename PeriodT, typename DelegateT, typename... ArgsT>
+		TimerToken ScheduleEvery(std::chrono::duration<RepT, PeriodT> period, DelegateT& delegate, ArgsT... in)
+		{
+			const std::uint64_t ticks = ToTicks(std::chrono::duration_cast<Clock::duration>(period));
+			return Schedule(new DLG_Details::ScheduledCall<DelegateT, ArgsT...>(delegate, std::move(in)...), ticks, ticks);
+		}
+
+		//* Stops the timer. A timer cancelled while firing finishes that call and does not repeat.
+		//@Return: True if a future call was cancelled.
+		bool Cancel(TimerToken& token)
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			bool cancelled = false;
+			if (token.IsValid() && token.Index < this->Timers.size())
+			{
+				Timer& timer = this->Timers[token.Index];
+				if (timer.Generation == token.Generation)
+				{
+					if (timer.State == TimerState::Scheduled)
+					{
+						Unlink(static_cast<int>(token.Index));
+						--this->ScheduledCount;
+						Deallocate(static_cast<int>(token.Index));
+						cancelled = true;
+					}
+					else if (timer.State == TimerState::Firing)
+					{
+						timer.State = TimerState::CancelledWhileFiring;
+						cancelled = timer.Period != 0;
+					}
+				}
+			}
+			token = TimerToken();
+			return cancelled;
+		}
+
+		//* Cancels every timer. Timers firing right now finish their call.
+		void CancelAll()
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			for (unsigned i = 0; i < this->Timers.size(); ++i)
+			{
+				Timer& timer = this->Timers[i];
+				if (timer.State == TimerState::Scheduled)
+				{
+					Unlink(static_cast<int>(i));
+					--this->ScheduledCount;
+					Deallocate(static_cast<int>(i));
+				}
+				else if (timer.State == TimerState::Firing)
+				{
+					timer.State = TimerState::CancelledWhileFiring;
+				}
+			}
+		}
+
+		//* Fires every timer due by the current time. Call from a tick loop.
+		void Update()
+		{
+			AdvanceTo(static_cast<std::uint64_t>((Clock::now() - this->Origin) / this->Resolution));
+		}
+
+		//* Advances a manual clock by 'ticks'. Do not mix with Update() or StartThread().
+		void AdvanceTicks(std::uint64_t ticks)
+		{
+			std::uint64_t now;
+			{
+				std::lock_guard<std::mutex> guard(this->Lock);
+				now = this->Now;
+			}
+			AdvanceTo(now + ticks);
+		}
+
+		//@Return: Amount of timers waiting to fire, periodic ones included.
+		unsigned Size() const
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			return this->ScheduledCount;
+		}
+
+		//* Drives the scheduler from a dedicated thread, ticking at the resolution.
+		void StartThread()
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			if (this->Running)
+			{
+				return;
+			}
+			this->Running = true;
+			this->Worker = std::thread([this]()
+			{
+				std::unique_lock<std::mutex> guard(this->Lock);
+				while (this->Running)
+				{
+					this->Wake.wait_for(guard, this->Resolution);
+					if (this->Running)
+					{
+						guard.unlock();
+						Update();
+						guard.lock();
+					}
+				}
+			});
+		}
+
+		//* Joins the thread started by StartThread(). Do not call from a fired delegate.
+		void StopThread()
+		{
+			{
+				std::lock_guard<std::mutex> guard(this->Lock);
+				this->Running = false;
+			}
+			this->Wake.notify_all();
+			if (this->Worker.joinable())
+			{
+				this->Worker.join();
+			}
+		}
+	};
+}
+
+#endif // !_DelScheduler_
@@ -0,0 +1,263 @@
+#pragma once
+#ifndef _DelTracing_
+#define _DelTracing_
+#include "DelegateDetails.h"
+#include "DelegateInstrumentation.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//* Define DLG_TRACING before including Delegates.h to record Broadcast and Execute spans.
+//* Spans are written into per thread buffers and exported as Chrome Trace Event JSON,
+//* viewable in chrome://tracing or ui.perfetto.dev.
+//* When it is not defined no tracing code is compiled.
+
+//* Events held per thread between flushes. Events past this are dropped and counted.
+#ifndef DLG_TRACE_BUFFER_EVENTS
+#define DLG_TRACE_BUFFER_EVENTS 8192
+#endif
+
+namespace DLG_Tracing
+{
+	//* Same clock as the instrumentation, so spans and statistics line up.
+	using DLG_Instrumentation::Now;
+
+	//* One complete span.
+	struct TraceEvent
+	{
+		const char* Name;
+		const char* Category;
+		const void* Delegate;
+		const void* Object;
+		const void* Function;
+		std::uint64_t Start;
+		std::uint64_t Duration;
+		std::uint32_t ThreadId;
+	};
+
+	//* Single producer, single consumer ring. The owning thread writes, WriteChromeTrace() reads.
+	class ThreadBuffer final
+	{
+	private:
+		friend class TraceRegistry;
+
+		TraceEvent Events[DLG_TRACE_BUFFER_EVENTS];
+		std::atomic<std::uint64_t> Write;
+		std::atomic<std::uint64_t> Read;
+		std::atomic<std::uint64_t> Dropped;
+		std::atomic<bool> Owned;
+		std::uint32_t ThreadId;
+
+	public:
+		explicit ThreadBuffer(std::uint32_t threadId)
+			: Write(0), Read(0), Dropped(0), Owned(true), ThreadId(threadId) {}
+
+		ThreadBuffer(const ThreadBuffer&) = delete;
+		ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+
+		//* Called only by the owning thread.
+		void Push(const TraceEvent& event)
+		{
+			const std::uint64_t write = this->Write.load(std::memory_order_relaxed);
+			if (write - this->Read.load(std::memory_order_acquire) >= DLG_TRACE_BUFFER_EVENTS)
+			{
+				this->Dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			TraceEvent& slot = this->Events[write % DLG_TRACE_BUFFER_EVENTS];
+			slot = event;
+			slot.ThreadId = this->ThreadId;
+			this->Write.store(write + 1, std::memory_order_release);
+		}
+	};
+
+	//* Tracing settings and per thread sampling state.
+	struct TraceConfig
+	{
+		//* 0 disables recording, 1 records every top level Broadcast, N records one in N.
+		//* Nested broadcasts follow the decision of the top level one.
+		static std::atomic<std::uint32_t>& SampleEvery()
+		{
+			static std::atomic<std::uint32_t> sampleEvery(1);
+			return sampleEvery;
+		}
+	};
+
+	//* Owns every thread buffer. Buffers of exited threads are reused by new threads.
+	class TraceRegistry final
+	{
+	private:
+		std::mutex Lock;
+		std::mutex FlushLock;
+		std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+		std::uint32_t NextThreadId;
+
+		TraceRegistry() : NextThreadId(1) {}
+
+		//* Releases the buffer when its thread exits.
+		struct Holder
+		{
+			ThreadBuffer* Buffer = nullptr;
+			~Holder()
+			{
+				if (this->Buffer != nullptr)
+				{
+					this->Buffer->Owned.store(false, std::memory_order_release);
+				}
+			}
+		};
+
+		ThreadBuffer* Claim()
+		{
+			std::lock_guard<std::mutex> guard(this->Lock);
+			const std::uint32_t threadId = this->NextThreadId++;
+			for (auto& buffer : this->Buffers)
+			{
+				bool owned = false;
+				if (buffer->Owned.compare_exchange_strong(owned, true, std::memory_order_acq_rel))
+				{
+					buffer->ThreadId = threadId;
+					return buffer.get();
+				}
+			}
+			this->Buffers.emplace_back(new ThreadBuffer(threadId));
+			return this->Buffers.back().get();
+		}
+
+	public:
+		static TraceRegistry& Get()
+		{
+			static TraceRegistry registry;
+			return registry;
+		}
+
+		//* Buffer of the calling thread, created on first use.
+		ThreadBuffer& Local()
+		{
+			thread_local Holder holder;
+			if (holder.Buffer == nullptr)
+			{
+				holder.Buffer = Claim();
+			}
+			return *holder.Buffer;
+		}
+
+		//* Moves every recorded event into 'out'.
+		//@Return: Amount of events dropped since the last flush because a buffer was full.
+		std::uint64_t Drain(std::vector<TraceEvent>& out)
+		{
+			std::lock_guard<std::mutex> flushGuard(this->FlushLock);
+			std::lock_guard<std::mutex> guard(this->Lock);
+			std::uint64_t dropped = 0;
+			for (auto& buffer : this->Buffers)
+			{
+				const std::uint64_t write = buffer->Write.load(std::memory_order_acquire);
+				std::uint64_t read = buffer->Read.load(std::memory_order_relaxed);
+				for (; read < write; ++read)
+				{
+					out.push_back(buffer->Events[read % DLG_TRACE_BUFFER_EVENTS]);
+				}
+				buffer->Read.store(read, std::memory_order_release);
+				dropped += buffer->Dropped.exchange(0, std::memory_order_relaxed);
+			}
+			return dropped;
+		}
+	};
+
+	//* RAII span around a Broadcast or a listener Execute. Records one complete event on destruction.
+	class Span final
+	{
+	private:
+		struct ThreadState
+		{
+			std::uint32_t Depth = 0;
+			std::uint32_t Counter = 0;
+			bool Sampled = false;
+		};
+
+		static ThreadState& State()
+		{
+			thread_local ThreadState state;
+			return state;
+		}
+
+		TraceEvent Event;
+		bool Active;
+
+	public:
+		Span(const char* name, const char* category, const void* delegate, const void* object = nullptr, const void* function = nullptr)
+		{
+			ThreadState& state = State();
+			if (state.Depth++ == 0)
+			{
+				const std::uint32_t sampleEvery = TraceConfig::SampleEvery().load(std::memory_order_relaxed);
+				state.Sampled = sampleEvery != 0 && (++state.Counter % sampleEvery) == 0;
+			}
+			this->Active = state.Sampled;
+			if (this->Active)
+			{
+				this->Event = TraceEvent{ name, category, delegate, object, function, Now(), 0, 0 };
+			}
+		}
+
+		//* Listener span. Reads object and function pointer only when sampled.
+		template <typename RetT>
+		Span(const char* name, const void* delegate, const DLG_Details::DelHandlerInterface<RetT>* bind)
+			: Span(name, "execute", delegate)
+		{
+			if (this->Active)
+			{
+				this->Event.Object = bind->GetObjectPointer();
+				this->Event.Function = bind->GetMemberFuncPointer();
+			}
+		}
+
+		Span(const Span&) = delete;
+		Span& operator=(const Span&) = delete;
+
+		~Span()
+		{
+			--State().Depth;
+			if (this->Active)
+			{
+				this->Event.Duration = Now() - this->Event.Start;
+				TraceRegistry::Get().Local().Push(this->Event);
+			}
+		}
+	};
+
+	//* Writes every recorded span to 'path' as Chrome Trace Event JSON and empties the buffers.
+	//@Return: False if the file could not be opened, the buffers are then left untouched.
+	inline bool WriteChromeTrace(const char* path)
+	{
+		std::FILE* file = std::fopen(path, "w");
+		if (file == nullptr)
+		{
+			return false;
+		}
+
+		std::vector<TraceEvent> events;
+		const std::uint64_t dropped = TraceRegistry::Get().Drain(events);
+
+		std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":%llu},\"traceEvents\":[",
+			static_cast<unsigned long long>(dropped));
+		for (std::size_t i = 0; i < events.size(); ++i)
+		{
+			const TraceEvent& event = events[i];
+			std::fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,"
+				"\"args\":{\"delegate\":\"%p\",\"object\":\"%p\",\"function\":\"%p\"}}",
+				(i == 0) ? "" : ",",
+				event.Name, event.Category, static_cast<unsigned>(event.ThreadId),
+				static_cast<double>(event.Start) / 1000.0, static_cast<double>(event.Duration) / 1000.0,
+				event.Delegate, event.Object, event.Function);
+		}
+		std::fprintf(file, "\n]}\n");
+		return std::fclose(file) == 0;
+	}
+}
+
+#endif // !_DelTracing_
@@ -4,10 +4,23 @@
 #include "DelegateDetails.h"
 
 //#include <functional>
+#include <iostream>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #define INDEX_NONE -1
 
+#ifdef DLG_INSTRUMENTATION
+#include "DelegateInstrumentation.h"
+#define DLG_NAMED_DELEGATES
+#endif
+
+#ifdef DLG_TRACING
+#include "DelegateTracing.h"
+#define DLG_NAMED_DELEGATES
+#endif
+
 //* Use for a context based delegate name.
 //* First argument is the disired delegate name, followed by any amount of parameters.
 //* Format: (DelegateName, type (optional), ...)
@@ -26,8 +39,106 @@
 #define MULTI_CAST_DELEGATE(DelegateName, ... ) \
 	using DelegateName = DLG::MultiCastDelegate<__VA_ARGS__>;
 
+//* The macros stay plain aliases with or without DLG_INSTRUMENTATION/DLG_TRACING, so turning diagnostics
+//* on never changes a type. Name a delegate for them by constructing it with a name: DelegateName d("OnHit");
+
+namespace DLG
+{
+	using DelegateMemoryUsage = DLG_Details::MemoryUsage;
+
+	//* Awaiter returned by MultiCastDelegate::Next(). Defined in DelegateCoroutines.h.
+	template <typename... ParamsT> class NextAwaiter;
+
+	//* Queue of a thread, used by MultiCastDelegate::AddBindOn() and Next(mailbox). Defined in DelegateMailbox.h.
+	class ThreadMailbox;
+}
+
+namespace DLG_Details
+{
+	inline namespace _bind
+	{
+		//* Defined in DelegateMailbox.h.
+		template<typename RetT, typename... ParamsT, typename... BArgsT>
+		DelHandlerInterface<RetT>* make_AffineDel(const std::shared_ptr<DLG::ThreadMailbox>& mailbox, DelHandlerInterface<RetT>* inner,
+			const std::tuple<ParamsT...>& allTuple, const std::tuple<BArgsT...>& payLoad);
+	}
+}
+
 namespace DLG
 {
+
+#ifdef DLG_MEMORY_ACCOUNTING
+	//* Handler totals across every delegate in the process. Inplace handlers are included although they are not on the heap.
+	inline DelegateMemoryUsage GlobalMemoryUsage()
+	{
+		return DLG_Details::GlobalMemory::Snapshot();
+	}
+#endif
+
+	template <typename DelegateT, typename RetT, typename ParamsGroupT, typename... StagesT> class PipelineBuilder;
+
+	//* Chain of Filter/Map stages started by delegate.Filter() or delegate.Map(). Bind() fuses the stages and
+	//* the target into a single handler on the delegate; nothing is bound before that.
+	//* Format: <'delegate type', 'return type', TypeGroup<'arguement type', ...>, 'stage', ...>
+	template <typename DelegateT, typename RetT, typename... ParamsT, typename... StagesT>
+	class PipelineBuilder<DelegateT, RetT, DLG_Details::TypeGroup<ParamsT...>, StagesT...> final
+	{
+	private:
+		template <typename StageT>
+		using Extended = PipelineBuilder<DelegateT, RetT, DLG_Details::TypeGroup<ParamsT...>, StagesT..., StageT>;
+
+		DelegateT* Delegate;
+		std::tuple<StagesT...> Stages;
+
+		template <typename TargetT>
+		void Attach(TargetT target)
+		{
+			this->Delegate->AttachHandler(new DLG_Details::PipelineDelHandler<DLG_Details::TypeGroup<RetT>, DLG_Details::TypeGroup<ParamsT...>,
+				TargetT, DLG_Details::TypeGroup<StagesT...>>(std::move(target), std::move(this->Stages)));
+		}
+
+	public:
+		PipelineBuilder(DelegateT& delegate, std::tuple<StagesT...> stages)
+			: Delegate(&delegate), Stages(std::move(stages)) {}
+
+		//* Adds a stage calling the rest of the pipeline only if 'pred' returns true for the current arguements.
+		template <typename PredT>
+		Extended<DLG_Details::FilterStage<PredT>> Filter(PredT pred) const
+		{
+			return Extended<DLG_Details::FilterStage<PredT>>(*this->Delegate,
+				std::tuple_cat(this->Stages, std::make_tuple(DLG_Details::FilterStage<PredT>{ std::move(pred) })));
+		}
+
+		//* Adds a stage replacing the current arguements with the result of 'fn'. Return a std::tuple for several.
+		template <typename FnT>
+		Extended<DLG_Details::MapStage<FnT>> Map(FnT fn) const
+		{
+			return Extended<DLG_Details::MapStage<FnT>>(*this->Delegate,
+				std::tuple_cat(this->Stages, std::make_tuple(DLG_Details::MapStage<FnT>{ std::move(fn) })));
+		}
+
+		//* Binds free function or functor as the end of the pipeline.
+		template <typename FnT>
+		void Bind(FnT fn)
+		{
+			Attach(DLG_Details::CallableTarget<FnT>{ std::move(fn) });
+		}
+
+		//* Binds method as the end of the pipeline.
+		template <typename ClassT, typename FuncT>
+		void Bind(ClassT* const target, FuncT func)
+		{
+			Attach(DLG_Details::RawTarget<ClassT, FuncT>{ target, func });
+		}
+
+		//* Binds smart pointer to class and its method as the end of the pipeline.
+		template <typename ClassT, typename FuncT>
+		void Bind(const std::shared_ptr<ClassT>& target, FuncT func)
+		{
+			Attach(DLG_Details::WeakTarget<ClassT, FuncT>{ target, func });
+		}
+	};
+
 	//* Format: <'return type' = void, 'arguement type' (optional), ...>
 	template <typename RetT, typename... ParamsT>
 	class SingleCastDelegate
@@ -39,6 +150,32 @@ namespace DLG
 
 	private:
 		DLG_Details::DelHandlerInterface<RetT>* s;
+#ifdef DLG_NAMED_DELEGATES
+		const char* DebugName = "SingleCastDelegate";
+#endif
+#ifdef DLG_INSTRUMENTATION
+		mutable DLG_Instrumentation::DelegateStats Stats;
+#endif
+
+		template <typename, typename, typename, typename...> friend class PipelineBuilder;
+
+	protected:
+		//* Every bind, pipeline bind and UnBind replaces the handler through here. 'handler' may be nullptr.
+		//* Derived delegates override it to react to rebinding.
+		virtual void AttachHandler(DLG_Details::DelHandlerInterface<RetT>* handler)
+		{
+			delete this->s;
+			this->s = handler;
+		}
+
+		//@Return: The bound handler if it can execute with 'ArgsT' and its object is alive; nullptr, if not.
+		template<typename... ArgsT>
+		DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>* FindHandler() const
+		{
+			auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>,
+				DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(this->s);
+			return (sp != nullptr && sp->IsValid() == true) ? sp : nullptr;
+		}
 
 	public:
 		SingleCastDelegate(): s(nullptr)
@@ -47,66 +184,106 @@ namespace DLG
 				, "Return type for a delegate must be default constructable.\n");
 		}
 
+		//* Names the delegate for instrumentation and tracing. The name is ignored when neither is on.
+		explicit SingleCastDelegate(const char* debugName) : SingleCastDelegate()
+		{
+#ifdef DLG_NAMED_DELEGATES
+			SetDebugName(debugName);
+#else
+			static_cast<void>(debugName);
+#endif
+		}
+
 		virtual ~SingleCastDelegate()
 		{
 			delete this->s;
 		}
 
+#ifdef DLG_NAMED_DELEGATES
+		//* Name reported by instrumentation and tracing. Also set by the naming constructor.
+		void SetDebugName(const char* name)
+		{
+			this->DebugName = name;
+#ifdef DLG_INSTRUMENTATION
+			this->Stats.SetName(name);
+#endif
+		}
+
+		const char* GetDebugName() const
+		{
+			return this->DebugName;
+		}
+#endif
+
+#ifdef DLG_INSTRUMENTATION
+		const DLG_Instrumentation::DelegateStats& GetStats() const
+		{
+			return this->Stats;
+		}
+#endif
+
 		//* Binds smart pointer to class and its method.
 		template <class ClassT, typename... ArgsT>
 		void Bind(const std::shared_ptr<ClassT> target, RetT(ClassT::*func)(ParamsT...), ArgsT... in)
 		{
-			delete this->s;
-			this->s = DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...));
+			AttachHandler(DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 		}
 
 		//* Binds smart pointer to class and its const method.
 		template <class ClassT, typename... ArgsT>
 		void Bind(const std::shared_ptr<ClassT> target, RetT(ClassT::*func)(ParamsT...) const, ArgsT... in)
 		{
-			delete this->s;
-			this->s = DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...));
+			AttachHandler(DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 		}
 
 		//* Binds free function.
 		template <typename... ArgsT>
 		void BindFunction(FreeFunc func, ArgsT... in)
 		{
-			delete this->s;
-			this->s = DLG_Details::make_FreeDel<RetT>(func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...));
+			AttachHandler(DLG_Details::make_FreeDel<RetT>(func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 		}
 
 		//* Binds functor
 		template <typename ClassT, typename... ArgsT>
 		void BindFunctor(ClassT* const target, ArgsT... in)
 		{
-			delete this->s;
 			static_assert(DLG_Details::Details::Traits::is_Functor<RetT, ClassT, ParamsT...>::value
 				, "Object is not a functor or does not properly overload operator() with the paramter or return types specified.\n");
-			this->s = DLG_Details::make_RawDel<RetT>(target, &ClassT::operator(), std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...));
+			AttachHandler(DLG_Details::make_RawDel<RetT>(target, &ClassT::operator(), std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 		}
 
 		//* Binds method.
 		template <class ClassT, typename... ArgsT>
 		void BindRaw(ClassT* const target, RetT(ClassT::*func)(ParamsT...), ArgsT... in)
 		{
-			delete this->s;
-			this->s = DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...));
+			AttachHandler(DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 		}
 
 		//* Binds const method.
 		template <class ClassT, typename... ArgsT>
 		void BindRaw(ClassT* const target, RetT(ClassT::*func)(ParamsT...) const, ArgsT... in)
 		{
-			delete this->s;
-			this->s = DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...));
+			AttachHandler(DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Starts a pipeline whose target runs only if 'pred' returns true. Unmatched calls return the default value.
+		template <typename PredT>
+		PipelineBuilder<SingleCastDelegate, RetT, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::FilterStage<PredT>> Filter(PredT pred)
+		{
+			return { *this, std::make_tuple(DLG_Details::FilterStage<PredT>{ std::move(pred) }) };
+		}
+
+		//* Starts a pipeline whose target receives the result of 'fn'.
+		template <typename FnT>
+		PipelineBuilder<SingleCastDelegate, RetT, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::MapStage<FnT>> Map(FnT fn)
+		{
+			return { *this, std::make_tuple(DLG_Details::MapStage<FnT>{ std::move(fn) }) };
 		}
 
 		//* UnBinds the methods attached to this delegate.
 		void UnBind()
 		{
-			delete this->s;
-			this->s = nullptr;
+			AttachHandler(nullptr);
 		}
 
 		//* True if object and method is bound; False, if not.
@@ -115,6 +292,17 @@ namespace DLG
 			return (this->s == nullptr) ? false : true;
 		}
 
+		//* Memory held by the bound handler.
+		DelegateMemoryUsage MemoryUsage() const
+		{
+			DelegateMemoryUsage usage;
+			if (this->s != nullptr)
+			{
+				this->s->AccumulateMemory(usage);
+			}
+			return usage;
+		}
+
 		//* Executes bound functions/methods.
 		template<typename... ArgsT>
 		RetT Execute(ArgsT... in) const
@@ -125,10 +313,28 @@ namespace DLG
 				return RetT();
 			}
 
-			auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>,
-				DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(this->s);
-			if (sp != nullptr && sp->IsValid() == true) //if calling object is not nullptr
+			auto* sp = FindHandler<ArgsT...>();
+			if (sp != nullptr) //if calling object is not nullptr
 			{
+#ifdef DLG_TRACING
+				DLG_Tracing::Span span(this->DebugName, this, this->s);
+#endif
+#ifdef DLG_INSTRUMENTATION
+				//records on scope exit, Execute may return void.
+				struct Probe
+				{
+					DLG_Instrumentation::DelegateStats& Stats;
+					const void* Object;
+					const void* Function;
+					std::uint64_t Start;
+					~Probe()
+					{
+						const std::uint64_t elapsed = DLG_Instrumentation::Now() - this->Start;
+						this->Stats.RecordBroadcast(1, elapsed);
+						this->Stats.RecordInvoke(this->Object, this->Function, elapsed);
+					}
+				} probe{ this->Stats, this->s->GetObjectPointer(), this->s->GetMemberFuncPointer(), DLG_Instrumentation::Now() };
+#endif
 				return sp->Execute(std::forward<ArgsT>(in)...);
 			}
 			else
@@ -147,6 +353,8 @@ namespace DLG
 
 	};
 
+	//* Not thread safe: Broadcast, binding and unbinding must not run on several threads at once. With AddBindOn
+	//* binds Broadcast may come from any thread, but only from one at a time.
 	//* Format: <'arguement type' (optional), ...>
 	template <typename... ParamsT>
 	class MultiCastDelegate
@@ -160,15 +368,27 @@ namespace DLG
 		using LambdaFunc_NoState = FreeFunc;
 		//using LambdaFunc_State = std::function< void(Params...)>;
 
+		//* Empty for non class targets, so a free function bound with a payload picks the FreeFunc overloads.
+		template<typename ClassT, typename = void>
+		struct MFSig {};
+
 		template<typename ClassT>
-		struct MFSig
+		struct MFSig<ClassT, typename std::enable_if<std::is_class<ClassT>::value>::type>
 		{
 			using MemberFunctionSignature = RetT(ClassT::*)(ParamsT...);
 			using MemberFunctionConstSignature = RetT(ClassT::*)(ParamsT...) const;
 		};
 
 		std::vector<DLG_Details::DelHandlerInterface<RetT>*> Member_Binds;
+		unsigned PersistentBinds = 0; //binds that stay valid until removed, see HasLiveListeners().
 		//int payLoadAmount;
+		mutable DLG_Details::WaiterList<ParamsT...> Waiters;
+#ifdef DLG_NAMED_DELEGATES
+		const char* DebugName = "MultiCastDelegate";
+#endif
+#ifdef DLG_INSTRUMENTATION
+		mutable DLG_Instrumentation::DelegateStats Stats;
+#endif
 
 	public:
 		MultiCastDelegate()
@@ -177,6 +397,16 @@ namespace DLG
 				, "Return type for a delegate must be default constructable.\n");
 		}
 
+		//* Names the delegate for instrumentation and tracing. The name is ignored when neither is on.
+		explicit MultiCastDelegate(const char* debugName) : MultiCastDelegate()
+		{
+#ifdef DLG_NAMED_DELEGATES
+			SetDebugName(debugName);
+#else
+			static_cast<void>(debugName);
+#endif
+		}
+
 		~MultiCastDelegate()
 		{
 			Clear();
@@ -187,31 +417,107 @@ namespace DLG
 			return this->Member_Binds.size();
 		}
 
+		//* Memory held by the binds and the bind list. Dead binds are the ones the next Broadcast prunes.
+		DelegateMemoryUsage MemoryUsage() const
+		{
+			DelegateMemoryUsage usage;
+			for (const auto& bind : this->Member_Binds)
+			{
+				bind->AccumulateMemory(usage);
+			}
+			usage.StorageBytes = this->Member_Binds.capacity() * sizeof(DLG_Details::DelHandlerInterface<RetT>*);
+			usage.SlackBytes = (this->Member_Binds.capacity() - this->Member_Binds.size()) * sizeof(DLG_Details::DelHandlerInterface<RetT>*);
+			return usage;
+		}
+
+		//* Releases unused bind list capacity.
+		void ShrinkToFit()
+		{
+			this->Member_Binds.shrink_to_fit();
+		}
+
+#ifdef DLG_NAMED_DELEGATES
+		//* Name reported by instrumentation and tracing. Also set by the naming constructor.
+		void SetDebugName(const char* name)
+		{
+			this->DebugName = name;
+#ifdef DLG_INSTRUMENTATION
+			this->Stats.SetName(name);
+#endif
+		}
+
+		const char* GetDebugName() const
+		{
+			return this->DebugName;
+		}
+#endif
+
+#ifdef DLG_INSTRUMENTATION
+		const DLG_Instrumentation::DelegateStats& GetStats() const
+		{
+			return this->Stats;
+		}
+#endif
+
 	private:
+		static bool IsPersistent(const DLG_Details::DelHandlerInterface<RetT>* bind)
+		{
+			return bind->CanExpire() == false && bind->IsValid();
+		}
+
+		void Push(DLG_Details::DelHandlerInterface<RetT>* bind)
+		{
+			this->PersistentBinds += IsPersistent(bind) ? 1 : 0;
+			this->Member_Binds.push_back(bind);
+		}
+
+		template <typename, typename, typename, typename...> friend class PipelineBuilder;
+
+		void AttachHandler(DLG_Details::DelHandlerInterface<RetT>* handler)
+		{
+			Push(handler);
+		}
+
 		void RemoveAt(int index)
 		{
 			if (index >= 0 && index < this->Member_Binds.size())
 			{
-				auto& back = this->Member_Binds.back();
-				std::swap(this->Member_Binds.at(index), back);
-				delete back;
-				this->Member_Binds.pop_back();
+				Remove(this->Member_Binds.at(index));
 			}
 		}
 
 		void Remove(DLG_Details::DelHandlerInterface<RetT>*& bind)
 		{
+			this->PersistentBinds -= IsPersistent(bind) ? 1 : 0;
 			auto& back = this->Member_Binds.back();
 			std::swap(bind, back);
 			delete back;
 			this->Member_Binds.pop_back();
 		}
 
+		template<typename... ArgsT, std::size_t... I>
+		void _BroadcastArgs(std::tuple<ArgsT...>& args, std::index_sequence<I...>)
+		{
+			this->template Broadcast<ParamsT...>(std::get<I>(args)...);
+		}
+
+		template<typename... ArgsT>
+		void _BroadcastArgs(std::tuple<ArgsT...>&& args)
+		{
+			_BroadcastArgs(args, std::index_sequence_for<ArgsT...>());
+		}
+
+		template<typename ArgT>
+		void _BroadcastArgs(ArgT&& arg)
+		{
+			this->template Broadcast<ParamsT...>(std::forward<ArgT>(arg));
+		}
+
 		//Find free del
 		//assums good form on startingIndex.
 		int FindBind(FreeFunc func, unsigned startingIndex = 0) const
 		{
-			return FindBind(nullptr, func, startingIndex);
+			return FindBind(static_cast<void*>(nullptr), func, startingIndex);
 		}
 
 		//Find member del
@@ -242,7 +548,7 @@ namespace DLG
 		{
 			if (_Contains(target.get(), func) == false)
 			{
-				this->Member_Binds.push_back(
+				Push(
 					DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 			}
 		}
@@ -252,7 +558,7 @@ namespace DLG
 		{
 			if (_Contains(target, func) == false)
 			{
-				this->Member_Binds.push_back(
+				Push(
 					DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 			}
 		}
@@ -260,17 +566,33 @@ namespace DLG
 		template <typename ClassT, typename FuncT, typename... ArgsT>
 		void _Bind(std::shared_ptr<ClassT>& target, FuncT func, ArgsT... in)
 		{
-			this->Member_Binds.push_back(
+			Push(
 				DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 		}
 
 		template <typename FuncT, typename ClassT, typename... ArgsT>
 		void _Bind(ClassT* const target, FuncT func, ArgsT... in)
 		{
-			this->Member_Binds.push_back(
+			Push(
 				DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 		}
 
+		template <typename ClassT, typename FuncT, typename... ArgsT>
+		void _BindOn(const std::shared_ptr<ThreadMailbox>& mailbox, std::shared_ptr<ClassT>& target, FuncT func, ArgsT... in)
+		{
+			const std::tuple<ArgsT...> payLoad(in...);
+			Push(DLG_Details::make_AffineDel<RetT>(mailbox,
+				DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), payLoad), std::tuple<ParamsT...>(), payLoad));
+		}
+
+		template <typename FuncT, typename ClassT, typename... ArgsT>
+		void _BindOn(const std::shared_ptr<ThreadMailbox>& mailbox, ClassT* const target, FuncT func, ArgsT... in)
+		{
+			const std::tuple<ArgsT...> payLoad(in...);
+			Push(DLG_Details::make_AffineDel<RetT>(mailbox,
+				DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), payLoad), std::tuple<ParamsT...>(), payLoad));
+		}
+
 		template <typename ClassT, typename FuncT>
 		void _UnBind(ClassT* const target, FuncT func)
 		{
@@ -295,6 +617,12 @@ namespace DLG
 		template<typename... ArgsT>
 		void Broadcast(ArgsT... in)
 		{
+#ifdef DLG_TRACING
+			DLG_Tracing::Span broadcastSpan(this->DebugName, "broadcast", this);
+#endif
+#ifdef DLG_INSTRUMENTATION
+			const std::uint64_t broadcastStart = DLG_Instrumentation::Now();
+#endif
 			for (unsigned i = 0; i < this->Member_Binds.size(); )
 			{
 				auto& bind = Member_Binds[i];
@@ -304,7 +632,19 @@ namespace DLG
 					auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(bind);
 					if (sp != nullptr)
 					{
-						sp->Execute(std::forward<ArgsT>(in)...);
+#ifdef DLG_TRACING
+						DLG_Tracing::Span span(this->DebugName, this, bind);
+#endif
+#ifdef DLG_INSTRUMENTATION
+						//read before Execute, the listener may unbind itself.
+						const void* object = bind->GetObjectPointer();
+						const void* function = bind->GetMemberFuncPointer();
+						const std::uint64_t invokeStart = DLG_Instrumentation::Now();
+						sp->Execute(in...);
+						this->Stats.RecordInvoke(object, function, DLG_Instrumentation::Now() - invokeStart);
+#else
+						sp->Execute(in...);
+#endif
 					}
 					else
 					{
@@ -317,12 +657,25 @@ namespace DLG
 					Remove(bind);
 				}
 			}
+#ifdef DLG_INSTRUMENTATION
+			this->Stats.RecordBroadcast(this->Member_Binds.size(), DLG_Instrumentation::Now() - broadcastStart);
+#endif
+			if (this->Waiters.IsEmpty() == false)
+			{
+				this->Waiters.NotifyAll(in...);
+			}
 		}
 
 		//* Calls binded functions.
 		template<typename... ArgsT>
 		void Broadcast(ArgsT... in) const
 		{
+#ifdef DLG_TRACING
+			DLG_Tracing::Span broadcastSpan(this->DebugName, "broadcast", this);
+#endif
+#ifdef DLG_INSTRUMENTATION
+			const std::uint64_t broadcastStart = DLG_Instrumentation::Now();
+#endif
 			for (unsigned i = 0; i < this->Member_Binds.size(); ++i)
 			{
 				auto& bind = Member_Binds[i];
@@ -332,7 +685,19 @@ namespace DLG
 					auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(bind);
 					if (sp != nullptr)
 					{
-						sp->Execute(std::forward<ArgsT>(in)...);
+#ifdef DLG_TRACING
+						DLG_Tracing::Span span(this->DebugName, this, bind);
+#endif
+#ifdef DLG_INSTRUMENTATION
+						//read before Execute, the listener may unbind itself.
+						const void* object = bind->GetObjectPointer();
+						const void* function = bind->GetMemberFuncPointer();
+						const std::uint64_t invokeStart = DLG_Instrumentation::Now();
+						sp->Execute(in...);
+						this->Stats.RecordInvoke(object, function, DLG_Instrumentation::Now() - invokeStart);
+#else
+						sp->Execute(in...);
+#endif
 					}
 					else
 					{
@@ -340,6 +705,95 @@ namespace DLG
 					}
 				}
 			}
+#ifdef DLG_INSTRUMENTATION
+			this->Stats.RecordBroadcast(this->Member_Binds.size(), DLG_Instrumentation::Now() - broadcastStart);
+#endif
+			if (this->Waiters.IsEmpty() == false)
+			{
+				this->Waiters.NotifyAll(in...);
+			}
+		}
+
+		//* True if a Broadcast would reach anyone. Constant time unless every bind is a shared_ptr bind,
+		//* then stops at the first one still alive.
+		bool HasLiveListeners() const
+		{
+			if (this->PersistentBinds != 0 || this->Waiters.IsEmpty() == false)
+			{
+				return true;
+			}
+			for (const auto& bind : this->Member_Binds)
+			{
+				if (bind->IsValid())
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		//* As HasLiveListeners(), but removes the expired binds it passes, so each is visited once.
+		bool HasLiveListeners()
+		{
+			if (this->PersistentBinds != 0 || this->Waiters.IsEmpty() == false)
+			{
+				return true;
+			}
+			while (this->Member_Binds.empty() == false)
+			{
+				auto& bind = this->Member_Binds.back();
+				if (bind->IsValid())
+				{
+					return true;
+				}
+				Remove(bind);
+			}
+			return false;
+		}
+
+		//* Calls 'argFactory' and broadcasts its result, only if a bind is alive. The arguements are built once.
+		//* 'argFactory' returns the arguement, or a std::tuple of the arguements.
+		//@Return: True if the arguements were built and broadcast.
+		template<typename FactoryT>
+		bool BroadcastLazy(FactoryT&& argFactory)
+		{
+			if (HasLiveListeners() == false)
+			{
+				return false;
+			}
+			_BroadcastArgs(argFactory());
+			return true;
+		}
+
+		//* Awaitable resumed with the arguements of the next Broadcast. Include DelegateCoroutines.h to use.
+		//* The awaiter lives in the coroutine frame; waiting does not allocate.
+		//* Await it, and destroy a waiting coroutine, only on the thread that broadcasts.
+		template <typename AwaiterT = NextAwaiter<ParamsT...>>
+		AwaiterT Next()
+		{
+			return AwaiterT(this->Waiters);
+		}
+
+		//* As Next(), but the coroutine is resumed on the thread owning 'mailbox'. Only the resumption moves:
+		//* like Next(), it must be awaited on the thread broadcasting the delegate, as enlisting is not thread safe.
+		template <typename AwaiterT = NextAwaiter<ParamsT...>>
+		AwaiterT Next(const std::shared_ptr<ThreadMailbox>& mailbox)
+		{
+			return AwaiterT(this->Waiters, mailbox);
+		}
+
+		//* Starts a pipeline of stages fused into one bind. Listeners see only the arguements 'pred' returns true for.
+		template <typename PredT>
+		PipelineBuilder<MultiCastDelegate, RetT, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::FilterStage<PredT>> Filter(PredT pred)
+		{
+			return { *this, std::make_tuple(DLG_Details::FilterStage<PredT>{ std::move(pred) }) };
+		}
+
+		//* Starts a pipeline of stages fused into one bind. The listener receives the result of 'fn'.
+		template <typename FnT>
+		PipelineBuilder<MultiCastDelegate, RetT, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::MapStage<FnT>> Map(FnT fn)
+		{
+			return { *this, std::make_tuple(DLG_Details::MapStage<FnT>{ std::move(fn) }) };
 		}
 
 		//* Deletes all binds.
@@ -350,6 +804,7 @@ namespace DLG
 				delete bind;
 			}
 			this->Member_Binds.clear();
+			this->PersistentBinds = 0;
 		}
 
 		//* Broadcast
@@ -365,7 +820,7 @@ namespace DLG
 		{
 			if (ContainsBind(func) == false)
 			{
-				this->Member_Binds.push_back(
+				Push(
 					DLG_Details::make_FreeDel<RetT>(func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 			}
 		}
@@ -374,7 +829,7 @@ namespace DLG
 		template<typename... ArgsT>
 		void AddBind(FreeFunc func, ArgsT... in)
 		{
-			this->Member_Binds.push_back(
+			Push(
 				DLG_Details::make_FreeDel<RetT>(func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
 		}
 
@@ -391,7 +846,7 @@ namespace DLG
 			int index = 0;
 			do
 			{
-				index = FindBind(func, index);
+				index = FindBind(func, static_cast<unsigned>(index));
 				RemoveAt(index);
 
 			} while (index >= 0);
@@ -403,15 +858,15 @@ namespace DLG
 			return (FindBind(func) != INDEX_NONE);
 		}
 
-		//* Binds method. Allows duplicates.
+		//* Binds method provided that it is not already bound.
 		template <typename ClassT, typename... ArgsT>
 		void AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
 		{
 			_BindUnique(target, func, std::forward<ArgsT>(in)...);
 		}
 
-		//* Binds method. Allows duplicates.
-		template <typename RetT, typename ClassT, typename... ArgsT>
+		//* Binds method provided that it is not already bound.
+		template <typename ClassT, typename... ArgsT>
 		void AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
 		{
 			_BindUnique(target, func, std::forward<ArgsT>(in)...);
@@ -473,12 +928,13 @@ namespace DLG
 			return _Contains(target, func);
 		}
 
+		//@Return: True if any method of the object is bound; False, if not.
 		template <typename ClassT>
-		bool ContainsInstance(ClassT* const& target)
+		bool ContainsInstance(ClassT* const& target) const
 		{
 			for (const auto& bind : this->Member_Binds)
 			{
-				if (bind->GetMemberFuncPointer() == target)
+				if (bind->GetObjectPointer() == target)
 				{
 					return true;
 				}
@@ -576,6 +1032,45 @@ namespace DLG
 			return _Contains(target.get(), func);
 		}
 
+		//* Binds method to run on the thread owning 'mailbox'. Broadcasts from that thread call it inline,
+		//* broadcasts from other threads post it to the mailbox, run by its next Pump(). Allows duplicates.
+		//* Posted calls of a bind removed before the Pump() are dropped. Include DelegateMailbox.h to use.
+		template<typename... ArgsT>
+		void AddBindOn(const std::shared_ptr<ThreadMailbox>& mailbox, FreeFunc func, ArgsT... in)
+		{
+			const std::tuple<ArgsT...> payLoad(in...);
+			Push(DLG_Details::make_AffineDel<RetT>(mailbox,
+				DLG_Details::make_FreeDel<RetT>(func, std::tuple<ParamsT...>(), payLoad), std::tuple<ParamsT...>(), payLoad));
+		}
+
+		//* Binds method to run on the thread owning 'mailbox'. Allows duplicates.
+		template <typename ClassT, typename... ArgsT>
+		void AddBindOn(const std::shared_ptr<ThreadMailbox>& mailbox, ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			_BindOn(mailbox, target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds const method to run on the thread owning 'mailbox'. Allows duplicates.
+		template <typename ClassT, typename... ArgsT>
+		void AddBindOn(const std::shared_ptr<ThreadMailbox>& mailbox, ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			_BindOn(mailbox, target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method to run on the thread owning 'mailbox'. Allows duplicates.
+		template <typename ClassT, typename... ArgsT>
+		void AddBindOn(const std::shared_ptr<ThreadMailbox>& mailbox, std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			_BindOn(mailbox, target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds const method to run on the thread owning 'mailbox'. Allows duplicates.
+		template <typename ClassT, typename... ArgsT>
+		void AddBindOn(const std::shared_ptr<ThreadMailbox>& mailbox, std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			_BindOn(mailbox, target, func, std::forward<ArgsT>(in)...);
+		}
+
 		//UnBinds all methods of object instance.
 		template <typename ClassT>
 		void RemoveBindAllInstance(std::shared_ptr<ClassT>& target)
@@ -584,7 +1079,7 @@ namespace DLG
 		}
 
 		template <typename ClassT>
-		bool ContainsInstance(std::shared_ptr<ClassT>& target)
+		bool ContainsInstance(std::shared_ptr<ClassT>& target) const
 		{
 			return ContainsInstance(target.get());
 		}
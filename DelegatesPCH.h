@@ -0,0 +1,21 @@
+#pragma once
+#ifndef _DELEGATES_PCH_
+#define _DELEGATES_PCH_
+
+//* Precompiled header unit for the whole library. Define the same DLG_* flags when building the
+//* precompiled header as in the translation units using it, e.g.
+//*   cl /std:c++17 /Yc"DelegatesPCH.h" ...        g++ -std=c++17 -x c++-header DelegatesPCH.h
+#include "Delegates.h"
+#include "CoalescingDelegates.h"
+#include "ConcurrentDelegates.h"
+#include "DelegateCoroutines.h"
+#include "DelegateEpoch.h"
+#include "DelegateMailbox.h"
+#include "DelegateScheduler.h"
+#include "EventBus.h"
+#include "InplaceDelegates.h"
+#include "KeyedDelegates.h"
+#include "MemoizedDelegates.h"
+#include "ShardedDelegates.h"
+
+#endif // !_DELEGATES_PCH_
@@ -0,0 +1,266 @@
+#pragma once
+#ifndef _EVENT_BUS_
+#define _EVENT_BUS_
+#include "Delegates.h"
+
+#include <bitset>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+
+//* Declares an event tag for an EventBus.
+//* Format: (EventName, type (optional), ...)
+#define BUS_EVENT(EventName, ... ) \
+	struct EventName \
+	{ \
+		using Delegate = DLG::MultiCastDelegate<__VA_ARGS__>; \
+		static constexpr const char* Name = #EventName; \
+	};
+
+namespace DLG_Details
+{
+	//* Position of EventT in EventsT, resolved at compile time.
+	template <typename EventT, typename... EventsT> struct EventIndex;
+
+	template <typename EventT, typename... EventsT>
+	struct EventIndex<EventT, EventT, EventsT...> : std::integral_constant<std::size_t, 0> {};
+
+	template <typename EventT, typename OtherT, typename... EventsT>
+	struct EventIndex<EventT, OtherT, EventsT...> : std::integral_constant<std::size_t, 1 + EventIndex<EventT, EventsT...>::value> {};
+
+	template <typename EventT>
+	struct EventIndex<EventT>
+	{
+		static_assert(sizeof(EventT) == 0, "Event is not registered in this EventBus.\n");
+	};
+
+#ifdef DLG_NAMED_DELEGATES
+	template <typename EventT, typename DelegateT>
+	auto NameEventDelegate(DelegateT& delegate, int) -> decltype(delegate.SetDebugName(EventT::Name), void())
+	{
+		delegate.SetDebugName(EventT::Name);
+	}
+
+	template <typename EventT, typename DelegateT>
+	void NameEventDelegate(DelegateT&, long) {}
+#endif
+}
+
+namespace DLG
+{
+	//* Set of MultiCastDelegates addressed by event tag type. Every event resolves to a fixed slot
+	//* of a flat table at compile time; publishing does no lookup. Declare tags with BUS_EVENT.
+	//* Tracks which events each object subscribed to, so UnsubscribeAll only visits those delegates.
+	//* Format: <'event tag', ...>
+	template <typename... EventsT>
+	class EventBus
+	{
+	private:
+		using Table = std::tuple<typename EventsT::Delegate...>;
+		using EventMask = std::bitset<sizeof...(EventsT)>;
+
+		//* Events an object subscribed to. Owner is set for shared_ptr subscribers, so expired ones can be dropped.
+		struct Subscription
+		{
+			EventMask Events;
+			std::weak_ptr<const void> Owner;
+			bool Shared = false;
+		};
+
+		Table Delegates;
+		std::unordered_map<const void*, Subscription> Subscriptions; //reverse index, object -> events.
+		std::size_t PruneAt = 16; //index size that triggers the next sweep of expired subscribers.
+
+		template <typename EventT>
+		static constexpr std::size_t IndexOf()
+		{
+			return DLG_Details::EventIndex<EventT, EventsT...>::value;
+		}
+
+		//* Entry of 'object', reset if it belonged to an expired subscriber at the same address.
+		//* Sweeps expired subscribers once the index doubled since the last sweep, so it stays amortized constant.
+		Subscription& Entry(const void* object)
+		{
+			if (this->Subscriptions.size() >= this->PruneAt)
+			{
+				Prune();
+				this->PruneAt = (this->Subscriptions.size() * 2 > 16) ? this->Subscriptions.size() * 2 : 16;
+			}
+			Subscription& subscription = this->Subscriptions[object];
+			if (subscription.Shared && subscription.Owner.expired())
+			{
+				subscription = Subscription();
+			}
+			return subscription;
+		}
+
+		template <typename EventT>
+		void Track(const void* object)
+		{
+			Entry(object).Events.set(IndexOf<EventT>());
+		}
+
+		template <typename EventT, typename ClassT>
+		void Track(const std::shared_ptr<ClassT>& target)
+		{
+			Subscription& subscription = Entry(target.get());
+			subscription.Events.set(IndexOf<EventT>());
+			subscription.Owner = target;
+			subscription.Shared = true;
+		}
+
+		//* Clears EventT from the object's entry once none of its methods is bound to EventT anymore.
+		template <typename EventT>
+		void Untrack(const void* object)
+		{
+			auto found = this->Subscriptions.find(object);
+			if (found != this->Subscriptions.end() && Get<EventT>().ContainsInstance(object) == false)
+			{
+				found->second.Events.reset(IndexOf<EventT>());
+				if (found->second.Events.none())
+				{
+					this->Subscriptions.erase(found);
+				}
+			}
+		}
+
+		template <typename ClassT, std::size_t... I>
+		void _UnsubscribeAll(ClassT* const target, const EventMask& mask, std::index_sequence<I...>)
+		{
+			((mask.test(I) ? std::get<I>(this->Delegates).RemoveBindAllInstance(target) : void()), ...);
+		}
+
+	public:
+		EventBus()
+		{
+#ifdef DLG_NAMED_DELEGATES
+			(DLG_Details::NameEventDelegate<EventsT>(Get<EventsT>(), 0), ...);
+#endif
+		}
+
+		EventBus(const EventBus&) = delete;
+		EventBus& operator=(const EventBus&) = delete;
+
+		static constexpr std::size_t EventCount()
+		{
+			return sizeof...(EventsT);
+		}
+
+		//* Delegate of EventT, for the full MultiCastDelegate interface.
+		template <typename EventT>
+		typename EventT::Delegate& Get()
+		{
+			return std::get<IndexOf<EventT>()>(this->Delegates);
+		}
+
+		template <typename EventT>
+		const typename EventT::Delegate& Get() const
+		{
+			return std::get<IndexOf<EventT>()>(this->Delegates);
+		}
+
+		//* Broadcasts EventT.
+		template <typename EventT, typename... ArgsT>
+		void Publish(ArgsT... in)
+		{
+			Get<EventT>().Broadcast(std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds free function to EventT.
+		template <typename EventT, typename FuncT, typename... ArgsT>
+		void Subscribe(FuncT func, ArgsT... in)
+		{
+			Get<EventT>().AddBind(func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method to EventT and records the object in the reverse index.
+		template <typename EventT, typename ClassT, typename FuncT, typename... ArgsT>
+		typename std::enable_if<std::is_class<ClassT>::value>::type Subscribe(ClassT* const target, FuncT func, ArgsT... in)
+		{
+			Get<EventT>().AddBind(target, func, std::forward<ArgsT>(in)...);
+			Track<EventT>(target);
+		}
+
+		//* Binds method to EventT and records the object in the reverse index.
+		template <typename EventT, typename ClassT, typename FuncT, typename... ArgsT>
+		void Subscribe(std::shared_ptr<ClassT>& target, FuncT func, ArgsT... in)
+		{
+			Get<EventT>().AddBind(target, func, std::forward<ArgsT>(in)...);
+			Track<EventT>(target);
+		}
+
+		//* UnBinds free function from EventT.
+		template <typename EventT, typename FuncT>
+		void Unsubscribe(FuncT func)
+		{
+			Get<EventT>().RemoveBind(func);
+		}
+
+		//* UnBinds method from EventT. The object leaves the reverse index with its last bind.
+		template <typename EventT, typename ClassT, typename FuncT>
+		void Unsubscribe(ClassT* const target, FuncT func)
+		{
+			ClassT* object = target;
+			Get<EventT>().RemoveBind(object, func);
+			Untrack<EventT>(object);
+		}
+
+		template <typename EventT, typename ClassT, typename FuncT>
+		void Unsubscribe(std::shared_ptr<ClassT>& target, FuncT func)
+		{
+			Get<EventT>().RemoveBind(target, func);
+			Untrack<EventT>(target.get());
+		}
+
+		//* UnBinds every method of the object from every event it subscribed to through this bus.
+		template <typename ClassT>
+		void UnsubscribeAll(ClassT* const target)
+		{
+			auto found = this->Subscriptions.find(target);
+			if (found != this->Subscriptions.end())
+			{
+				_UnsubscribeAll(target, found->second.Events, std::index_sequence_for<EventsT...>());
+				this->Subscriptions.erase(found);
+			}
+		}
+
+		template <typename ClassT>
+		void UnsubscribeAll(std::shared_ptr<ClassT>& target)
+		{
+			UnsubscribeAll(target.get());
+		}
+
+		//* Drops reverse index entries of shared_ptr subscribers that expired.
+		void Prune()
+		{
+			for (auto it = this->Subscriptions.begin(); it != this->Subscriptions.end(); )
+			{
+				if (it->second.Shared && it->second.Owner.expired())
+				{
+					it = this->Subscriptions.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
+		//* Amount of objects in the reverse index.
+		std::size_t SubscriberCount() const
+		{
+			return this->Subscriptions.size();
+		}
+
+		//* Deletes all binds of every event.
+		void Clear()
+		{
+			(Get<EventsT>().Clear(), ...);
+			this->Subscriptions.clear();
+		}
+	};
+}
+
+#endif // !_EVENT_BUS_
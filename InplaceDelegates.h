@@ -0,0 +1,677 @@
+#pragma once
+#ifndef _INPLACE_DELEGATE_
+#define _INPLACE_DELEGATE_
+#include "Delegates.h"
+
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+
+//* Heap free single cast delegate. Handlers are stored in SlotSize bytes owned by the delegate.
+//* Format: (DelegateName, SlotSize, type (optional), ...)
+#define INPLACE_SINGLE_CAST_DELEGATE(DelegateName, SlotSize, ... ) \
+	using DelegateName = DLG::InplaceSingleCastDelegate<SlotSize, void, __VA_ARGS__>;
+
+//* Heap free single cast delegate. Handlers are stored in SlotSize bytes owned by the delegate.
+//* Format: (return type, DelegateName, SlotSize, type (optional), ...)
+#define INPLACE_SINGLE_CAST_DELEGATE_RetVal(RetT, DelegateName, SlotSize, ... ) \
+	using DelegateName = DLG::InplaceSingleCastDelegate<SlotSize, RetT, __VA_ARGS__>;
+
+//* Heap free multicast delegate. Holds at most Capacity binds of at most SlotSize bytes each.
+//* Format: (DelegateName, Capacity, SlotSize, type (optional), ...)
+#define INPLACE_MULTI_CAST_DELEGATE(DelegateName, Capacity, SlotSize, ... ) \
+	using DelegateName = DLG::InplaceMultiCastDelegate<Capacity, SlotSize, __VA_ARGS__>;
+
+namespace DLG
+{
+	//* Same interface as SingleCastDelegate, but never touches the heap.
+	//* A bind that does not fit in SlotSize bytes fails to compile.
+	//* Format: <'slot size', 'return type' = void, 'arguement type' (optional), ...>
+	template <std::size_t SlotSize, typename RetT, typename... ParamsT>
+	class InplaceSingleCastDelegate
+	{
+	private:
+		using FreeFunc = RetT(*)(ParamsT...);
+		using LambdaFunc_NoState = FreeFunc;
+
+	private:
+		DLG_Details::InplaceHandlerPool<RetT, 1, SlotSize> Pool;
+		DLG_Details::DelHandlerInterface<RetT>* s;
+
+	public:
+		InplaceSingleCastDelegate() : s(nullptr)
+		{
+			static_assert(std::is_void<RetT>::value == true || std::is_default_constructible<RetT>::value == true
+				, "Return type for a delegate must be default constructable.\n");
+		}
+
+		//* Handlers point into this object, it cannot be copied.
+		InplaceSingleCastDelegate(const InplaceSingleCastDelegate&) = delete;
+		InplaceSingleCastDelegate& operator=(const InplaceSingleCastDelegate&) = delete;
+
+		virtual ~InplaceSingleCastDelegate()
+		{
+			UnBind();
+		}
+
+	private:
+		//* Returns the storage for the next handler, destroying the current one.
+		//* The slot stays free until Commit(), in case constructing the handler throws.
+		void* Reset()
+		{
+			UnBind();
+			return this->Pool.SlotMemory(this->Pool.NextFree());
+		}
+
+		//* Takes the slot returned by Reset() for the handler constructed in it.
+		void Commit(DLG_Details::DelHandlerInterface<RetT>* handler)
+		{
+			this->Pool.Acquire();
+			this->s = handler;
+		}
+
+	public:
+		//* Binds smart pointer to class and its method.
+		template <class ClassT, typename... ArgsT>
+		void Bind(const std::shared_ptr<ClassT> target, RetT(ClassT::*func)(ParamsT...), ArgsT... in)
+		{
+			Commit(DLG_Details::emplace_MemberDel<RetT, SlotSize>(Reset(), target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds smart pointer to class and its const method.
+		template <class ClassT, typename... ArgsT>
+		void Bind(const std::shared_ptr<ClassT> target, RetT(ClassT::*func)(ParamsT...) const, ArgsT... in)
+		{
+			Commit(DLG_Details::emplace_MemberDel<RetT, SlotSize>(Reset(), target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds free function.
+		template <typename... ArgsT>
+		void BindFunction(FreeFunc func, ArgsT... in)
+		{
+			Commit(DLG_Details::emplace_FreeDel<RetT, SlotSize>(Reset(), func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds functor
+		template <typename ClassT, typename... ArgsT>
+		void BindFunctor(ClassT* const target, ArgsT... in)
+		{
+			static_assert(DLG_Details::Details::Traits::is_Functor<RetT, ClassT, ParamsT...>::value
+				, "Object is not a functor or does not properly overload operator() with the paramter or return types specified.\n");
+			Commit(DLG_Details::emplace_RawDel<RetT, SlotSize>(Reset(), target, &ClassT::operator(), std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds method.
+		template <class ClassT, typename... ArgsT>
+		void BindRaw(ClassT* const target, RetT(ClassT::*func)(ParamsT...), ArgsT... in)
+		{
+			Commit(DLG_Details::emplace_RawDel<RetT, SlotSize>(Reset(), target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds const method.
+		template <class ClassT, typename... ArgsT>
+		void BindRaw(ClassT* const target, RetT(ClassT::*func)(ParamsT...) const, ArgsT... in)
+		{
+			Commit(DLG_Details::emplace_RawDel<RetT, SlotSize>(Reset(), target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* UnBinds the methods attached to this delegate.
+		void UnBind()
+		{
+			if (this->s != nullptr)
+			{
+				this->Pool.Release(0, this->s);
+				this->s = nullptr;
+			}
+		}
+
+		//* True if object and method is bound; False, if not.
+		bool IsBound() const
+		{
+			return (this->s == nullptr) ? false : true;
+		}
+
+		//* Memory used by the bound handler. TotalBytes() is the size of the delegate; SlackBytes is the slot space not used by the handler.
+		DelegateMemoryUsage MemoryUsage() const
+		{
+			DelegateMemoryUsage usage;
+			if (this->s != nullptr)
+			{
+				this->s->AccumulateMemory(usage);
+			}
+			usage.StorageBytes = sizeof(*this) - usage.HandlerBytes;
+			usage.SlackBytes = SlotSize - usage.HandlerBytes;
+			return usage;
+		}
+
+		//* Executes bound functions/methods.
+		template<typename... ArgsT>
+		RetT Execute(ArgsT... in) const
+		{
+			if (IsBound() == false)
+			{
+				std::cerr << "Executing unbound delegate. Pointers will be nullptr else default contructor is called.\n";
+				return RetT();
+			}
+
+			auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>,
+				DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(this->s);
+			if (sp != nullptr && sp->IsValid() == true) //if calling object is not nullptr
+			{
+				return sp->Execute(std::forward<ArgsT>(in)...);
+			}
+			else
+			{
+				std::cerr << "To many arguements or wrong types to execute. Pointers will be nullptr else default contructor is called.\n";
+				return RetT();
+			}
+		}
+
+		//* Executes bound functions/methods.
+		template <typename... ArgsT>
+		RetT operator()(ArgsT... in) const
+		{
+			return this->Execute(std::forward<ArgsT>(in)...);
+		}
+	};
+
+	//* Same interface as MultiCastDelegate, but never touches the heap.
+	//* Holds at most Capacity binds. AddBind returns false when the delegate is full; the bind is dropped and counted in OverflowCount().
+	//* A bind that does not fit in SlotSize bytes fails to compile.
+	//* Format: <'capacity', 'slot size', 'arguement type' (optional), ...>
+	template <std::size_t Capacity, std::size_t SlotSize, typename... ParamsT>
+	class InplaceMultiCastDelegate
+	{
+	public:
+		using RetT = void;
+		using params = DLG_Details::TypeGroup<ParamsT...>;
+
+	private:
+		using FreeFunc = RetT(*)(ParamsT...);
+		using LambdaFunc_NoState = FreeFunc;
+
+		//* Empty for non class targets, so a free function bound with a payload picks the FreeFunc overloads.
+		template<typename ClassT, typename = void>
+		struct MFSig {};
+
+		template<typename ClassT>
+		struct MFSig<ClassT, typename std::enable_if<std::is_class<ClassT>::value>::type>
+		{
+			using MemberFunctionSignature = RetT(ClassT::*)(ParamsT...);
+			using MemberFunctionConstSignature = RetT(ClassT::*)(ParamsT...) const;
+		};
+
+		struct InplaceBind
+		{
+			DLG_Details::DelHandlerInterface<RetT>* Handler;
+			std::size_t Slot;
+		};
+
+		DLG_Details::InplaceHandlerPool<RetT, Capacity, SlotSize> Pool;
+		InplaceBind Member_Binds[Capacity];
+		std::size_t Count;
+		std::size_t Overflows;
+
+	public:
+		InplaceMultiCastDelegate() : Count(0), Overflows(0)
+		{
+		}
+
+		//* Handlers point into this object, it cannot be copied.
+		InplaceMultiCastDelegate(const InplaceMultiCastDelegate&) = delete;
+		InplaceMultiCastDelegate& operator=(const InplaceMultiCastDelegate&) = delete;
+
+		~InplaceMultiCastDelegate()
+		{
+			Clear();
+		}
+
+		int Size() const
+		{
+			return static_cast<int>(this->Count);
+		}
+
+		//* Maximum amount of binds.
+		static constexpr int MaxSize()
+		{
+			return static_cast<int>(Capacity);
+		}
+
+		bool IsFull() const
+		{
+			return this->Count == Capacity;
+		}
+
+		//* Amount of binds rejected because the delegate was full.
+		std::size_t OverflowCount() const
+		{
+			return this->Overflows;
+		}
+
+		//* Memory used by the binds. TotalBytes() is the size of the delegate; SlackBytes is the slot and bind list space not in use.
+		DelegateMemoryUsage MemoryUsage() const
+		{
+			DelegateMemoryUsage usage;
+			for (std::size_t i = 0; i < this->Count; ++i)
+			{
+				this->Member_Binds[i].Handler->AccumulateMemory(usage);
+			}
+			usage.StorageBytes = sizeof(*this) - usage.HandlerBytes;
+			usage.SlackBytes = Capacity * SlotSize - usage.HandlerBytes + (Capacity - this->Count) * sizeof(InplaceBind);
+			return usage;
+		}
+
+	private:
+		void RemoveAt(int index)
+		{
+			if (index >= 0 && static_cast<std::size_t>(index) < this->Count)
+			{
+				InplaceBind& bind = this->Member_Binds[index];
+				this->Pool.Release(bind.Slot, bind.Handler);
+				bind = this->Member_Binds[--this->Count];
+			}
+		}
+
+		//* Storage for a new bind. Returns nullptr and records the overflow when full.
+		//* The slot stays free until Commit(), in case constructing the handler throws.
+		void* Reserve()
+		{
+			if (IsFull())
+			{
+				++this->Overflows;
+				return nullptr;
+			}
+			return this->Pool.SlotMemory(this->Pool.NextFree());
+		}
+
+		//* Commits the handler constructed in the slot returned by Reserve().
+		bool Commit(DLG_Details::DelHandlerInterface<RetT>* handler)
+		{
+			InplaceBind& bind = this->Member_Binds[this->Count++];
+			bind.Slot = this->Pool.Acquire();
+			bind.Handler = handler;
+			return true;
+		}
+
+		//Find free del
+		//assums good form on startingIndex.
+		int FindBind(FreeFunc func, unsigned startingIndex = 0) const
+		{
+			return FindBind(static_cast<void*>(nullptr), func, startingIndex);
+		}
+
+		//Find member del
+		//assums good form on startingIndex.
+		template <typename ClassT, typename FuncT>
+		int FindBind(ClassT* const target, FuncT func, unsigned startingIndex = 0) const
+		{
+			for (std::size_t i = startingIndex; i < this->Count; ++i)
+			{
+				auto bind = this->Member_Binds[i].Handler;
+				if (target == bind->GetObjectPointer()
+					&& DLG_Details::Details::is_equal(func, bind->GetMemberFuncPointer()) == true)
+				{
+					return static_cast<int>(i);
+				}
+			}
+			return INDEX_NONE;
+		}
+
+		template <typename ClassT, typename FuncT>
+		bool _Contains(ClassT* const target, FuncT func) const
+		{
+			return (FindBind(target, func) != INDEX_NONE);
+		}
+
+		template <typename ClassT, typename FuncT, typename... ArgsT>
+		bool _Bind(std::shared_ptr<ClassT>& target, FuncT func, ArgsT... in)
+		{
+			void* mem = Reserve();
+			return mem != nullptr && Commit(
+				DLG_Details::emplace_MemberDel<RetT, SlotSize>(mem, target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		template <typename FuncT, typename ClassT, typename... ArgsT>
+		bool _Bind(ClassT* const target, FuncT func, ArgsT... in)
+		{
+			void* mem = Reserve();
+			return mem != nullptr && Commit(
+				DLG_Details::emplace_RawDel<RetT, SlotSize>(mem, target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		template <typename FuncT, typename ClassT, typename... ArgsT>
+		bool _BindUnique(std::shared_ptr<ClassT>& target, FuncT func, ArgsT... in)
+		{
+			return _Contains(target.get(), func) == false && _Bind(target, func, in...);
+		}
+
+		template <typename ClassT, typename FuncT, typename... ArgsT>
+		bool _BindUnique(ClassT* const target, FuncT func, ArgsT... in)
+		{
+			return _Contains(target, func) == false && _Bind(target, func, in...);
+		}
+
+		template <typename ClassT, typename FuncT>
+		void _UnBind(ClassT* const target, FuncT func)
+		{
+			int index = 0;
+			do
+			{
+				index = FindBind(target, func, static_cast<unsigned>(index));
+				RemoveAt(index);
+
+			} while (index >= 0);
+		}
+
+		template <typename FuncT, typename ClassT>
+		void _UnBindSingle(ClassT* const target, FuncT func)
+		{
+			int index = FindBind(target, func);
+			RemoveAt(index);
+		}
+
+	public:
+		//* Calls binded functions. Automatically removes invalid binds.
+		template<typename... ArgsT>
+		void Broadcast(ArgsT... in)
+		{
+			for (std::size_t i = 0; i < this->Count; )
+			{
+				auto bind = this->Member_Binds[i].Handler;
+
+				if (bind->IsValid())
+				{
+					auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(bind);
+					if (sp != nullptr)
+					{
+						sp->Execute(in...);
+					}
+					else
+					{
+						std::cerr << "To many arguements or wrong types to execute. Return value may be undifined.\n";
+					}
+					++i;
+				}
+				else
+				{
+					RemoveAt(static_cast<int>(i));
+				}
+			}
+		}
+
+		//* Calls binded functions.
+		template<typename... ArgsT>
+		void Broadcast(ArgsT... in) const
+		{
+			for (std::size_t i = 0; i < this->Count; ++i)
+			{
+				auto bind = this->Member_Binds[i].Handler;
+
+				if (bind->IsValid())
+				{
+					auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(bind);
+					if (sp != nullptr)
+					{
+						sp->Execute(in...);
+					}
+					else
+					{
+						std::cerr << "To many arguements or wrong types to execute. Return value may be undifined.\n";
+					}
+				}
+			}
+		}
+
+		//* Deletes all binds.
+		void Clear()
+		{
+			while (this->Count > 0)
+			{
+				RemoveAt(static_cast<int>(this->Count) - 1);
+			}
+		}
+
+		//* Broadcast
+		template<typename... ArgsT>
+		void operator()(ArgsT... in)
+		{
+			this->Broadcast(std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method provided that it is not already bound.
+		//@Return: False if already bound or the delegate is full.
+		template<typename... ArgsT>
+		bool AddBindUnique(FreeFunc func, ArgsT... in)
+		{
+			return ContainsBind(func) == false && AddBind(func, in...);
+		}
+
+		//* Binds method. Allows duplicates.
+		//@Return: False if the delegate is full.
+		template<typename... ArgsT>
+		bool AddBind(FreeFunc func, ArgsT... in)
+		{
+			void* mem = Reserve();
+			return mem != nullptr && Commit(
+				DLG_Details::emplace_FreeDel<RetT, SlotSize>(mem, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* UnBinds the first bind that matches the function signature.
+		void RemoveBindSingle(FreeFunc func)
+		{
+			int index = FindBind(func);
+			RemoveAt(index);
+		}
+
+		//* UnBinds all methods matching the function signature.
+		void RemoveBind(FreeFunc func)
+		{
+			int index = 0;
+			do
+			{
+				index = FindBind(func, static_cast<unsigned>(index));
+				RemoveAt(index);
+
+			} while (index >= 0);
+		}
+
+		//@Return: True if method is bound; False, if not.
+		bool ContainsBind(FreeFunc func) const
+		{
+			return (FindBind(func) != INDEX_NONE);
+		}
+
+		//* Binds method provided that it is not already bound.
+		//@Return: False if already bound or the delegate is full.
+		template <typename ClassT, typename... ArgsT>
+		bool AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			return _BindUnique(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method provided that it is not already bound.
+		//@Return: False if already bound or the delegate is full.
+		template <typename ClassT, typename... ArgsT>
+		bool AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			return _BindUnique(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method. Allows duplicates.
+		//@Return: False if the delegate is full.
+		template <typename ClassT, typename... ArgsT>
+		bool AddBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			return _Bind(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method. Allows duplicates.
+		//@Return: False if the delegate is full.
+		template <typename ClassT, typename... ArgsT>
+		bool AddBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			return _Bind(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* UnBinds all methods matching the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			_UnBind(target, func);
+		}
+
+		//* UnBinds all methods matching the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			_UnBind(target, func);
+		}
+
+		//* UnBinds the first bind that matches the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBindSingle(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			_UnBindSingle(target, func);
+		}
+
+		//* UnBinds the first bind that matches the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBindSingle(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			_UnBindSingle(target, func);
+		}
+
+		//@Return: True if object and method is bound; False, if not.
+		template <typename ClassT>
+		bool ContainsBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func) const
+		{
+			return _Contains(target, func);
+		}
+
+		//@Return: True if object and method is bound; False, if not.
+		template <typename ClassT>
+		bool ContainsBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func) const
+		{
+			return _Contains(target, func);
+		}
+
+		template <typename ClassT>
+		bool ContainsInstance(ClassT* const& target) const
+		{
+			for (std::size_t i = 0; i < this->Count; ++i)
+			{
+				if (this->Member_Binds[i].Handler->GetObjectPointer() == target)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		//UnBinds all methods of object instance.
+		template <typename ClassT>
+		void RemoveBindAllInstance(ClassT* const& target)
+		{
+			for (std::size_t i = 0; i < this->Count; )
+			{
+				if (target == this->Member_Binds[i].Handler->GetObjectPointer())
+				{
+					RemoveAt(static_cast<int>(i));
+				}
+				else
+				{
+					++i;
+				}
+			}
+		}
+
+		//* Binds method provided that it is not already bound.
+		//@Return: False if already bound or the delegate is full.
+		template <typename ClassT, typename... ArgsT>
+		bool AddBindUnique(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			return _BindUnique(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method provided that it is not already bound.
+		//@Return: False if already bound or the delegate is full.
+		template <typename ClassT, typename... ArgsT>
+		bool AddBindUnique(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			return _BindUnique(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method. Allows duplicates.
+		//@Return: False if the delegate is full.
+		template <typename ClassT, typename... ArgsT>
+		bool AddBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			return _Bind(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method. Allows duplicates.
+		//@Return: False if the delegate is full.
+		template <typename ClassT, typename... ArgsT>
+		bool AddBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			return _Bind(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* UnBinds all methods matching the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			_UnBind(target.get(), func);
+		}
+
+		//* UnBinds all methods matching the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			_UnBind(target.get(), func);
+		}
+
+		//* UnBinds the first bind that matches the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBindSingle(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			_UnBindSingle(target.get(), func);
+		}
+
+		//* UnBinds the first bind that matches the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBindSingle(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			_UnBindSingle(target.get(), func);
+		}
+
+		//@Return: True if object and method is bound; False, if not.
+		template <typename ClassT>
+		bool ContainsBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func) const
+		{
+			return _Contains(target.get(), func);
+		}
+
+		//@Return: True if object and method is bound; False, if not.
+		template <typename ClassT>
+		bool ContainsBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func) const
+		{
+			return _Contains(target.get(), func);
+		}
+
+		//UnBinds all methods of object instance.
+		template <typename ClassT>
+		void RemoveBindAllInstance(std::shared_ptr<ClassT>& target)
+		{
+			RemoveBindAllInstance(target.get());
+		}
+
+		template <typename ClassT>
+		bool ContainsInstance(std::shared_ptr<ClassT>& target) const
+		{
+			return ContainsInstance(target.get());
+		}
+	};
+}
+
+#endif // !_INPLACE_DELEGATE_
@@ -0,0 +1,575 @@
+#pragma once
+#ifndef _KEYED_DELEGATE_
+#define _KEYED_DELEGATE_
+#include "Delegates.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//* Multicast delegate that calls keyed binds only for broadcasts carrying their key.
+//* Format: (key type, DelegateName, type (optional), ...)
+#define KEYED_MULTI_CAST_DELEGATE(KeyT, DelegateName, ... ) \
+	using DelegateName = DLG::KeyedMultiCastDelegate<KeyT, __VA_ARGS__>;
+
+namespace DLG_Details
+{
+	//* Default key extractor, the first arguement.
+	template <typename KeyT, typename FirstT, typename... RestT>
+	KeyT FirstArguementKey(const FirstT& first, const RestT&...)
+	{
+		return KeyT(first);
+	}
+}
+
+namespace DLG
+{
+	//* MultiCastDelegate with binds indexed by key. Broadcast() extracts the key from its arguements, calls the
+	//* unkeyed binds, then only the keyed binds in the bucket of that key; keyed binds of other keys cost nothing.
+	//* The key is the first arguement unless a key extractor is given. KeyT needs std::hash and operator==.
+	//* Broadcast() takes every arguement, so binds take no payload.
+	//* Inherits MultiCastDelegate privately; members that would not see the keyed binds (BroadcastLazy, Next,
+	//* Filter/Map, AddBindOn) are not exposed. AddBind, RemoveBind and ContainsBind act on the unkeyed binds;
+	//* Size, MemoryUsage, HasLiveListeners, ContainsInstance, RemoveBindAllInstance and Clear cover both.
+	//* Binds removed while a broadcast runs are nulled and deleted once the outermost broadcast returns.
+	//* Not thread safe, same as MultiCastDelegate.
+	//* Format: <'key type', 'arguement type' (optional), ...>
+	template <typename KeyT, typename... ParamsT>
+	class KeyedMultiCastDelegate : private MultiCastDelegate<ParamsT...>
+	{
+	public:
+		using RetT = void;
+
+		//* Computes the key of a broadcast from its arguements.
+		//* A captureless lambda converts to this.
+		using KeyFunc = KeyT(*)(const typename std::decay<ParamsT>::type&... in);
+
+	private:
+		using Base = MultiCastDelegate<ParamsT...>;
+		using FreeFunc = RetT(*)(ParamsT...);
+		using Handler = DLG_Details::DelHandlerInterface<RetT>;
+		using Bucket = std::vector<Handler*>;
+
+		template<typename ClassT, typename = void>
+		struct MFSig {};
+
+		template<typename ClassT>
+		struct MFSig<ClassT, typename std::enable_if<std::is_class<ClassT>::value>::type>
+		{
+			using MemberFunctionSignature = RetT(ClassT::*)(ParamsT...);
+			using MemberFunctionConstSignature = RetT(ClassT::*)(ParamsT...) const;
+		};
+
+		template<typename... ArgsT>
+		static constexpr void AssertNoPayload()
+		{
+			static_assert(sizeof...(ArgsT) == 0, "Keyed binds take no payload, Broadcast() passes every arguement.\n");
+		}
+
+		std::unordered_map<KeyT, Bucket> Index;
+		KeyFunc Extract;
+		std::size_t KeyedBinds = 0;
+		unsigned BroadcastDepth = 0; //buckets are not erased or reordered while a broadcast may be iterating them.
+		std::vector<Handler*> Removed; //binds removed during a broadcast, deleted after it.
+		std::vector<KeyT> Dirty; //keys whose bucket holds nulled slots.
+
+		//* Ends a broadcast. The outermost one compacts the buckets binds were removed from and deletes those binds.
+		struct BroadcastScope
+		{
+			KeyedMultiCastDelegate& Delegate;
+
+			~BroadcastScope()
+			{
+				if (--this->Delegate.BroadcastDepth == 0)
+				{
+					this->Delegate.Settle();
+				}
+			}
+		};
+
+		void Push(const KeyT& key, Handler* bind)
+		{
+			this->Index[key].push_back(bind);
+			++this->KeyedBinds;
+		}
+
+		//* Deletes the bind at 'index' of the bucket in 'found'. While a broadcast runs the slot is only
+		//* nulled, so the bucket being iterated keeps its order and a running bind is not deleted.
+		//@Return: Index of the next bind to visit.
+		template <typename IteratorT>
+		std::size_t Remove(IteratorT found, std::size_t index)
+		{
+			Bucket& bucket = found->second;
+			--this->KeyedBinds;
+			if (this->BroadcastDepth > 0)
+			{
+				this->Removed.push_back(bucket[index]);
+				bucket[index] = nullptr;
+				this->Dirty.push_back(found->first);
+				return index + 1;
+			}
+			std::swap(bucket[index], bucket.back());
+			delete bucket.back();
+			bucket.pop_back();
+			return index;
+		}
+
+		void Settle()
+		{
+			for (const KeyT& key : this->Dirty)
+			{
+				auto found = this->Index.find(key);
+				if (found != this->Index.end())
+				{
+					Bucket& bucket = found->second;
+					bucket.erase(std::remove(bucket.begin(), bucket.end(), nullptr), bucket.end());
+					EraseIfEmpty(found);
+				}
+			}
+			this->Dirty.clear();
+			for (Handler* bind : this->Removed)
+			{
+				delete bind;
+			}
+			this->Removed.clear();
+		}
+
+		template <typename IteratorT>
+		void EraseIfEmpty(IteratorT found)
+		{
+			if (found->second.empty() && this->BroadcastDepth == 0)
+			{
+				this->Index.erase(found);
+			}
+		}
+
+		template <typename ClassT, typename FuncT>
+		void _UnBind(const KeyT& key, ClassT* const target, FuncT func, bool single)
+		{
+			auto found = this->Index.find(key);
+			if (found == this->Index.end())
+			{
+				return;
+			}
+			Bucket& bucket = found->second;
+			for (std::size_t i = 0; i < bucket.size(); )
+			{
+				if (bucket[i] != nullptr && target == bucket[i]->GetObjectPointer()
+					&& DLG_Details::Details::is_equal(func, bucket[i]->GetMemberFuncPointer()) == true)
+				{
+					i = Remove(found, i);
+					if (single)
+					{
+						break;
+					}
+				}
+				else
+				{
+					++i;
+				}
+			}
+			EraseIfEmpty(found);
+		}
+
+		template <typename ClassT, typename FuncT, typename... ArgsT>
+		void _Bind(const KeyT& key, std::shared_ptr<ClassT>& target, FuncT func, ArgsT... in)
+		{
+			AssertNoPayload<ArgsT...>();
+			Push(key, DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		template <typename FuncT, typename ClassT, typename... ArgsT>
+		void _Bind(const KeyT& key, ClassT* const target, FuncT func, ArgsT... in)
+		{
+			AssertNoPayload<ArgsT...>();
+			Push(key, DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		void ClearKeyed()
+		{
+			for (auto& entry : this->Index)
+			{
+				for (Handler* bind : entry.second)
+				{
+					delete bind;
+				}
+			}
+			this->Index.clear();
+			this->KeyedBinds = 0;
+			Settle();
+		}
+
+	public:
+		//* Keys broadcasts by their first arguement.
+		KeyedMultiCastDelegate()
+		{
+			static_assert(sizeof...(ParamsT) > 0, "Keyed delegates need an arguement to take the key from.\n");
+			this->Extract = &DLG_Details::FirstArguementKey<KeyT, typename std::decay<ParamsT>::type...>;
+		}
+
+		explicit KeyedMultiCastDelegate(KeyFunc extractor) : Extract(extractor) {}
+
+		~KeyedMultiCastDelegate()
+		{
+			ClearKeyed();
+		}
+
+		KeyedMultiCastDelegate(const KeyedMultiCastDelegate&) = delete;
+		KeyedMultiCastDelegate& operator=(const KeyedMultiCastDelegate&) = delete;
+
+		using Base::ShrinkToFit;
+		using Base::RemoveBind;
+		using Base::RemoveBindSingle;
+		using Base::ContainsBind;
+#ifdef DLG_NAMED_DELEGATES
+		using Base::SetDebugName;
+		using Base::GetDebugName;
+#endif
+#ifdef DLG_INSTRUMENTATION
+		using Base::GetStats;
+#endif
+
+		//* Unkeyed and keyed binds.
+		int Size() const
+		{
+			return Base::Size() + static_cast<int>(this->KeyedBinds);
+		}
+
+		//* Memory of the unkeyed and keyed binds. StorageBytes adds the bucket vectors and an estimate of the
+		//* index nodes and bucket table; allocator overhead is not included.
+		DelegateMemoryUsage MemoryUsage() const
+		{
+			DelegateMemoryUsage usage = Base::MemoryUsage();
+			for (const auto& entry : this->Index)
+			{
+				for (Handler* bind : entry.second)
+				{
+					if (bind != nullptr)
+					{
+						bind->AccumulateMemory(usage);
+					}
+				}
+				usage.StorageBytes += entry.second.capacity() * sizeof(Handler*);
+				usage.SlackBytes += (entry.second.capacity() - entry.second.size()) * sizeof(Handler*);
+			}
+			usage.StorageBytes += this->Index.size() * sizeof(typename std::unordered_map<KeyT, Bucket>::value_type)
+				+ this->Index.bucket_count() * sizeof(void*);
+			return usage;
+		}
+
+		//* True if a Broadcast of some key would reach anyone. Stops at the first bind still alive.
+		bool HasLiveListeners() const
+		{
+			if (Base::HasLiveListeners())
+			{
+				return true;
+			}
+			for (const auto& entry : this->Index)
+			{
+				for (Handler* bind : entry.second)
+				{
+					if (bind != nullptr && bind->IsValid())
+					{
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+
+		//@Return: True if any method of the object is bound, keyed or not.
+		template <class ClassT>
+		bool ContainsInstance(ClassT* const& target) const
+		{
+			if (Base::ContainsInstance(target))
+			{
+				return true;
+			}
+			for (const auto& entry : this->Index)
+			{
+				for (Handler* bind : entry.second)
+				{
+					if (bind != nullptr && bind->GetObjectPointer() == target)
+					{
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+
+		template <class ClassT>
+		bool ContainsInstance(std::shared_ptr<ClassT>& target) const
+		{
+			return ContainsInstance(target.get());
+		}
+
+		//* Binds free function, called for every broadcast. Allows duplicates.
+		void AddBind(FreeFunc func)
+		{
+			Base::AddBind(func);
+		}
+
+		//* Binds free function provided that it is not already bound unkeyed.
+		void AddBindUnique(FreeFunc func)
+		{
+			Base::AddBindUnique(func);
+		}
+
+		//* Binds method, called for every broadcast. Allows duplicates.
+		template <class ClassT>
+		void AddBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			Base::AddBind(target, func);
+		}
+
+		template <class ClassT>
+		void AddBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			Base::AddBind(target, func);
+		}
+
+		template <class ClassT>
+		void AddBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			Base::AddBind(target, func);
+		}
+
+		template <class ClassT>
+		void AddBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			Base::AddBind(target, func);
+		}
+
+		//* Binds method provided that it is not already bound unkeyed.
+		template <class ClassT>
+		void AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			Base::AddBindUnique(target, func);
+		}
+
+		template <class ClassT>
+		void AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			Base::AddBindUnique(target, func);
+		}
+
+		template <class ClassT>
+		void AddBindUnique(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			Base::AddBindUnique(target, func);
+		}
+
+		template <class ClassT>
+		void AddBindUnique(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			Base::AddBindUnique(target, func);
+		}
+
+		//@Return: Amount of keys with at least one bind.
+		std::size_t GetKeyCount() const
+		{
+			return this->Index.size();
+		}
+
+		//@Return: Amount of binds under 'key'.
+		int CountKey(const KeyT& key) const
+		{
+			auto found = this->Index.find(key);
+			//nulled slots are binds removed by a running broadcast.
+			return found == this->Index.end() ? 0
+				: static_cast<int>(std::count_if(found->second.begin(), found->second.end(), [](Handler* bind) { return bind != nullptr; }));
+		}
+
+		//* Calls the unkeyed binds and the binds of the arguements' key. Automatically removes invalid binds.
+		template<typename... ArgsT>
+		void Broadcast(ArgsT... in)
+		{
+			static_assert(sizeof...(ArgsT) == sizeof...(ParamsT), "Keyed broadcasts take exactly the delegate's arguements.\n");
+			const KeyT key = this->Extract(in...);
+			Base::Broadcast(in...);
+
+			auto found = this->Index.find(key);
+			if (found == this->Index.end())
+			{
+				return;
+			}
+
+			++this->BroadcastDepth;
+			BroadcastScope scope{ *this };
+			Bucket& bucket = found->second; //stays valid, rehashing does not move elements.
+			for (std::size_t i = 0; i < bucket.size(); )
+			{
+				Handler* bind = bucket[i];
+				if (bind == nullptr)
+				{
+					++i;
+				}
+				else if (bind->IsValid())
+				{
+					auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(bind);
+					if (sp != nullptr)
+					{
+						sp->Execute(in...);
+					}
+					else
+					{
+						std::cerr << "To many arguements or wrong types to execute. Return value may be undifined.\n";
+					}
+					++i;
+				}
+				else
+				{
+					i = Remove(found, i);
+				}
+			}
+		}
+
+		//* Broadcast
+		template<typename... ArgsT>
+		void operator()(ArgsT... in)
+		{
+			this->Broadcast(std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds free function, called only for broadcasts of 'key'. Allows duplicates.
+		template<typename... ArgsT>
+		void AddBindKeyed(const KeyT& key, FreeFunc func, ArgsT... in)
+		{
+			AssertNoPayload<ArgsT...>();
+			Push(key, DLG_Details::make_FreeDel<RetT>(func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds method, called only for broadcasts of 'key'. Allows duplicates.
+		template <class ClassT, typename... ArgsT>
+		void AddBindKeyed(const KeyT& key, ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			_Bind(key, target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds const method, called only for broadcasts of 'key'. Allows duplicates.
+		template <class ClassT, typename... ArgsT>
+		void AddBindKeyed(const KeyT& key, ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			_Bind(key, target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds smart pointer to class and its method, called only for broadcasts of 'key'. Allows duplicates.
+		template <class ClassT, typename... ArgsT>
+		void AddBindKeyed(const KeyT& key, std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			_Bind(key, target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds smart pointer to class and its const method, called only for broadcasts of 'key'. Allows duplicates.
+		template <class ClassT, typename... ArgsT>
+		void AddBindKeyed(const KeyT& key, std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			_Bind(key, target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* UnBinds all binds of 'key' matching the function signature.
+		void RemoveBindKeyed(const KeyT& key, FreeFunc func)
+		{
+			_UnBind(key, static_cast<void*>(nullptr), func, false);
+		}
+
+		//* UnBinds all binds of 'key' matching the object and method.
+		template <class ClassT, typename FuncT>
+		void RemoveBindKeyed(const KeyT& key, ClassT* const& target, FuncT func)
+		{
+			_UnBind(key, target, func, false);
+		}
+
+		template <class ClassT, typename FuncT>
+		void RemoveBindKeyed(const KeyT& key, std::shared_ptr<ClassT>& target, FuncT func)
+		{
+			_UnBind(key, target.get(), func, false);
+		}
+
+		//* UnBinds the first bind of 'key' matching the object and method.
+		template <class ClassT, typename FuncT>
+		void RemoveBindKeyedSingle(const KeyT& key, ClassT* const& target, FuncT func)
+		{
+			_UnBind(key, target, func, true);
+		}
+
+		//* Deletes every bind of 'key'.
+		void RemoveKey(const KeyT& key)
+		{
+			auto found = this->Index.find(key);
+			if (found != this->Index.end())
+			{
+				for (std::size_t i = 0; i < found->second.size(); )
+				{
+					i = (found->second[i] != nullptr) ? Remove(found, i) : i + 1;
+				}
+				EraseIfEmpty(found);
+			}
+		}
+
+		//* UnBinds every method of the object, keyed or not. Visits every key.
+		template <class ClassT>
+		void RemoveBindAllInstance(ClassT* const& target)
+		{
+			Base::RemoveBindAllInstance(target);
+			for (auto found = this->Index.begin(); found != this->Index.end(); )
+			{
+				Bucket& bucket = found->second;
+				for (std::size_t i = 0; i < bucket.size(); )
+				{
+					if (bucket[i] != nullptr && target == bucket[i]->GetObjectPointer())
+					{
+						i = Remove(found, i);
+					}
+					else
+					{
+						++i;
+					}
+				}
+				if (bucket.empty() && this->BroadcastDepth == 0)
+				{
+					found = this->Index.erase(found);
+				}
+				else
+				{
+					++found;
+				}
+			}
+		}
+
+		template <class ClassT>
+		void RemoveBindAllInstance(std::shared_ptr<ClassT>& target)
+		{
+			RemoveBindAllInstance(target.get());
+		}
+
+		//* Deletes all binds, keyed and unkeyed.
+		void Clear()
+		{
+			Base::Clear();
+			if (this->BroadcastDepth == 0)
+			{
+				ClearKeyed();
+			}
+			else
+			{
+				for (auto found = this->Index.begin(); found != this->Index.end(); ++found)
+				{
+					for (std::size_t i = 0; i < found->second.size(); )
+					{
+						i = (found->second[i] != nullptr) ? Remove(found, i) : i + 1;
+					}
+				}
+			}
+		}
+	};
+}
+
+#endif // !_KEYED_DELEGATE_
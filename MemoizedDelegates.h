@@ -0,0 +1,153 @@
+#pragma once
+#ifndef _MEMOIZED_DELEGATE_
+#define _MEMOIZED_DELEGATE_
+#include "Delegates.h"
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//* Single cast delegate caching the results of a pure bound function.
+//* Format: (return type, DelegateName, CacheSize, type (optional), ...)
+#define MEMOIZED_SINGLE_CAST_DELEGATE_RetVal(RetT, DelegateName, CacheSize, ... ) \
+	using DelegateName = DLG::MemoizedSingleCastDelegate<CacheSize, RetT, __VA_ARGS__>;
+
+namespace DLG_Details
+{
+	namespace Details
+	{
+		template<typename... ArgsT, std::size_t... I>
+		std::size_t hash_tuple(const std::tuple<ArgsT...>& args, std::index_sequence<I...>)
+		{
+			std::size_t seed = 0;
+			((seed ^= std::hash<ArgsT>()(std::get<I>(args)) + 0x9e3779b9 + (seed << 6) + (seed >> 2)), ...);
+			return seed;
+		}
+
+		//* Combines std::hash of every element.
+		template<typename... ArgsT>
+		std::size_t hash_tuple(const std::tuple<ArgsT...>& args)
+		{
+			return hash_tuple(args, std::index_sequence_for<ArgsT...>());
+		}
+	}
+}
+
+namespace DLG
+{
+	//* SingleCastDelegate returning cached results for arguements it was already executed with.
+	//* Results live in a direct mapped cache of CacheSize entries; a new result replaces the entry its arguements hash to.
+	//* Binding, unbinding or binding a Filter/Map pipeline empties the cache. Call InvalidateCache() when the bound
+	//* function stops being pure. Calls that do not reach the function (unbound, expired target) are not cached, and
+	//* empty the cache so an expired target's results are not returned.
+	//* Arguements need std::hash and operator==. Not thread safe, same as SingleCastDelegate.
+	//* Format: <'cache size', 'return type', 'arguement type' (optional), ...>
+	template <std::size_t CacheSize, typename RetT, typename... ParamsT>
+	class MemoizedSingleCastDelegate : public SingleCastDelegate<RetT, ParamsT...>
+	{
+	private:
+		using Base = SingleCastDelegate<RetT, ParamsT...>;
+		using Key = std::tuple<typename std::decay<ParamsT>::type...>;
+
+		struct Entry
+		{
+			bool Valid = false;
+			Key Args;
+			RetT Value;
+		};
+
+		mutable Entry Cache[CacheSize];
+		mutable std::size_t Hits = 0;
+		mutable std::size_t Misses = 0;
+
+		//* The cache is mutable, so const Execute can empty it too.
+		void ClearEntries() const
+		{
+			for (Entry& entry : this->Cache)
+			{
+				entry.Valid = false;
+			}
+		}
+
+	protected:
+		//* Every bind, Filter/Map pipeline and UnBind lands here, also when made through a SingleCastDelegate&.
+		virtual void AttachHandler(DLG_Details::DelHandlerInterface<RetT>* handler) override
+		{
+			InvalidateCache();
+			Base::AttachHandler(handler);
+		}
+
+	public:
+		MemoizedSingleCastDelegate()
+		{
+			static_assert(std::is_void<RetT>::value == false, "Memoizing needs a return value.\n");
+			static_assert(CacheSize > 0, "Cache size must be at least 1.\n");
+		}
+
+		//* Returns the cached result, or executes the bound function and caches its result.
+		template<typename... ArgsT>
+		RetT Execute(ArgsT... in) const
+		{
+			//unbound, expired or mismatched calls return a default value that is not the function's result.
+			if (this->template FindHandler<ArgsT...>() == nullptr)
+			{
+				++this->Misses;
+				ClearEntries(); //results of an expired target must not outlive it.
+				return Base::Execute(std::forward<ArgsT>(in)...);
+			}
+
+			Key key(in...);
+			Entry& entry = this->Cache[DLG_Details::Details::hash_tuple(key) % CacheSize];
+			if (entry.Valid && entry.Args == key)
+			{
+				++this->Hits;
+				return entry.Value;
+			}
+
+			++this->Misses;
+			RetT value = Base::Execute(std::forward<ArgsT>(in)...);
+			entry.Valid = true;
+			entry.Args = std::move(key);
+			entry.Value = value;
+			return value;
+		}
+
+		//* Executes bound functions/methods.
+		template <typename... ArgsT>
+		RetT operator()(ArgsT... in) const
+		{
+			return this->Execute(std::forward<ArgsT>(in)...);
+		}
+
+		//* Forgets every cached result.
+		void InvalidateCache()
+		{
+			ClearEntries();
+		}
+
+		std::size_t GetHitCount() const
+		{
+			return this->Hits;
+		}
+
+		std::size_t GetMissCount() const
+		{
+			return this->Misses;
+		}
+
+		void ResetCacheStats()
+		{
+			this->Hits = 0;
+			this->Misses = 0;
+		}
+
+		static constexpr std::size_t GetCacheSize()
+		{
+			return CacheSize;
+		}
+	};
+}
+
+#endif // !_MEMOIZED_DELEGATE_
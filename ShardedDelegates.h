@@ -0,0 +1,556 @@
+#pragma once
+#ifndef _SHARDED_DELEGATE_
+#define _SHARDED_DELEGATE_
+#include "Delegates.h"
+#include "DelegateEpoch.h"
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//* Multicast delegate for many threads binding and unbinding concurrently.
+//* Format: (DelegateName, type (optional), ...)
+#define SHARDED_MULTI_CAST_DELEGATE(DelegateName, ... ) \
+	using DelegateName = DLG::ShardedMultiCastDelegate<__VA_ARGS__>;
+
+namespace DLG_Details
+{
+	//* Shard of the calling thread. Threads are spread round robin over the shards on first use.
+	inline unsigned LocalShardSeed()
+	{
+		static std::atomic<unsigned> next(0);
+		thread_local unsigned seed = next.fetch_add(1, std::memory_order_relaxed);
+		return seed;
+	}
+}
+
+namespace DLG
+{
+	//* MultiCastDelegate split into per thread shards. Binding and unbinding lock only the calling thread's shard,
+	//* so they scale with the amount of threads. Broadcast visits every shard. Binding, unbinding and Broadcast
+	//* may run on any threads at once.
+	//* Broadcast holds no lock while listeners run, so listeners may bind and unbind on the same delegate.
+	//* RemoveBind, RemoveBindSingle, RemoveBindAllInstance and Clear return once no Broadcast can still call the
+	//* removed binds, so a raw pointer or functor target may be destroyed right after. Called from inside a
+	//* listener they cannot wait for the calling Broadcast; destroy a raw target only after it returned.
+	//* Binds whose shared_ptr target expired are skipped but stay in their shard until Prune() is called.
+	//* Format: <'arguement type' (optional), ...>
+	template <typename... ParamsT>
+	class ShardedMultiCastDelegate
+	{
+	public:
+		using RetT = void;
+		using params = DLG_Details::TypeGroup<ParamsT...>;
+
+	private:
+		using FreeFunc = RetT(*)(ParamsT...);
+		using HandlerPtr = std::shared_ptr<DLG_Details::DelHandlerInterface<RetT>>;
+
+		//* Empty for non class targets, so a free function bound with a payload picks the FreeFunc overloads.
+		template<typename ClassT, typename = void>
+		struct MFSig {};
+
+		template<typename ClassT>
+		struct MFSig<ClassT, typename std::enable_if<std::is_class<ClassT>::value>::type>
+		{
+			using MemberFunctionSignature = RetT(ClassT::*)(ParamsT...);
+			using MemberFunctionConstSignature = RetT(ClassT::*)(ParamsT...) const;
+		};
+
+		struct alignas(DLG_CACHE_LINE_SIZE) Shard
+		{
+			std::mutex Lock;
+			std::vector<HandlerPtr> Member_Binds;
+		};
+
+		std::unique_ptr<Shard[]> Shards;
+		unsigned ShardCount;
+
+		Shard& LocalShard() const
+		{
+			return this->Shards[DLG_Details::LocalShardSeed() % this->ShardCount];
+		}
+
+		void Push(DLG_Details::DelHandlerInterface<RetT>* bind)
+		{
+			HandlerPtr handler(bind);
+			Shard& shard = LocalShard();
+			std::lock_guard<std::mutex> guard(shard.Lock);
+			shard.Member_Binds.push_back(std::move(handler));
+		}
+
+		//* Removes matching binds from 'shard'.
+		//@Return: Amount removed.
+		template <typename ClassT, typename FuncT>
+		int RemoveFrom(Shard& shard, ClassT* const target, FuncT func, bool single)
+		{
+			std::vector<HandlerPtr> removed; //destroyed after the lock is released.
+			{
+				std::lock_guard<std::mutex> guard(shard.Lock);
+				auto& binds = shard.Member_Binds;
+				for (std::size_t i = 0; i < binds.size(); )
+				{
+					if (target == binds[i]->GetObjectPointer()
+						&& DLG_Details::Details::is_equal(func, binds[i]->GetMemberFuncPointer()) == true)
+					{
+						removed.push_back(std::move(binds[i]));
+						binds[i] = std::move(binds.back());
+						binds.pop_back();
+						if (single)
+						{
+							break;
+						}
+					}
+					else
+					{
+						++i;
+					}
+				}
+			}
+			return static_cast<int>(removed.size());
+		}
+
+		//* Returns once no Broadcast running elsewhere can still reach a bind removed before the call.
+		static void WaitForBroadcasts()
+		{
+			DLG_Details::EpochDomain::Instance().Synchronize();
+		}
+
+		//* Local shard first. 'single' stops at the first match; otherwise every shard is searched,
+		//* since other threads may have bound the same target.
+		template <typename ClassT, typename FuncT>
+		void _UnBind(ClassT* const target, FuncT func, bool single)
+		{
+			Shard& local = LocalShard();
+			int removed = RemoveFrom(local, target, func, single);
+			for (unsigned i = 0; i < this->ShardCount && (removed == 0 || single == false); ++i)
+			{
+				Shard& shard = this->Shards[i];
+				if (&shard != &local)
+				{
+					removed += RemoveFrom(shard, target, func, single);
+				}
+			}
+			if (removed > 0)
+			{
+				WaitForBroadcasts();
+			}
+		}
+
+		//@Return: True if 'shard' holds a bind matching 'target' and 'func'. The caller holds the shard's lock.
+		template <typename ClassT, typename FuncT>
+		static bool Holds(const Shard& shard, ClassT* const target, FuncT func)
+		{
+			for (const auto& bind : shard.Member_Binds)
+			{
+				if (target == bind->GetObjectPointer()
+					&& DLG_Details::Details::is_equal(func, bind->GetMemberFuncPointer()) == true)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		template <typename ClassT, typename FuncT>
+		bool _Contains(ClassT* const target, FuncT func) const
+		{
+			for (unsigned s = 0; s < this->ShardCount; ++s)
+			{
+				std::lock_guard<std::mutex> guard(this->Shards[s].Lock);
+				if (Holds(this->Shards[s], target, func))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		//* Pushes 'bind' to the local shard unless a matching bind exists in any shard.
+		//* Every shard is locked, in index order, so two threads cannot both add the same bind.
+		//* The handler is made before locking and dropped if a match is found.
+		template <typename ClassT, typename FuncT>
+		void PushUnique(ClassT* const target, FuncT func, DLG_Details::DelHandlerInterface<RetT>* bind)
+		{
+			HandlerPtr handler(bind);
+			{
+				std::vector<std::unique_lock<std::mutex>> locks;
+				locks.reserve(this->ShardCount);
+				for (unsigned s = 0; s < this->ShardCount; ++s)
+				{
+					locks.emplace_back(this->Shards[s].Lock);
+					if (Holds(this->Shards[s], target, func))
+					{
+						return;
+					}
+				}
+				LocalShard().Member_Binds.push_back(std::move(handler));
+			}
+		}
+
+		template <typename ClassT, typename FuncT, typename... ArgsT>
+		void _BindUnique(std::shared_ptr<ClassT>& target, FuncT func, ArgsT... in)
+		{
+			PushUnique(target.get(), func,
+				DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		template <typename FuncT, typename ClassT, typename... ArgsT>
+		void _BindUnique(ClassT* const target, FuncT func, ArgsT... in)
+		{
+			PushUnique(target, func,
+				DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		template <typename ClassT, typename FuncT, typename... ArgsT>
+		void _Bind(std::shared_ptr<ClassT>& target, FuncT func, ArgsT... in)
+		{
+			Push(DLG_Details::make_MemberDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		template <typename FuncT, typename ClassT, typename... ArgsT>
+		void _Bind(ClassT* const target, FuncT func, ArgsT... in)
+		{
+			Push(DLG_Details::make_RawDel<RetT>(target, func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+	public:
+		//* 'shardCount' of 0 uses one shard per hardware thread.
+		explicit ShardedMultiCastDelegate(unsigned shardCount = 0)
+		{
+			if (shardCount == 0)
+			{
+				shardCount = std::thread::hardware_concurrency();
+			}
+			this->ShardCount = (shardCount == 0) ? 1 : shardCount;
+			this->Shards.reset(new Shard[this->ShardCount]);
+		}
+
+		ShardedMultiCastDelegate(const ShardedMultiCastDelegate&) = delete;
+		ShardedMultiCastDelegate& operator=(const ShardedMultiCastDelegate&) = delete;
+
+		unsigned GetShardCount() const
+		{
+			return this->ShardCount;
+		}
+
+		//* Sum of every shard. Only exact while no thread binds or unbinds.
+		int Size() const
+		{
+			int size = 0;
+			for (unsigned i = 0; i < this->ShardCount; ++i)
+			{
+				std::lock_guard<std::mutex> guard(this->Shards[i].Lock);
+				size += static_cast<int>(this->Shards[i].Member_Binds.size());
+			}
+			return size;
+		}
+
+		//* Calls binded functions in every shard. Each shard is locked only while its binds are copied.
+		//* The whole call is an epoch read section, which removal waits for.
+		template<typename... ArgsT>
+		void Broadcast(ArgsT... in) const
+		{
+			DLG_Details::EpochGuard epoch;
+			thread_local std::vector<HandlerPtr> snapshot;
+			const std::size_t base = snapshot.size(); //nested broadcasts stack their snapshots.
+
+			//* Pops this broadcast's snapshot even if a listener throws.
+			struct SnapshotScope
+			{
+				std::vector<HandlerPtr>& Snapshot;
+				const std::size_t Base;
+				~SnapshotScope() { this->Snapshot.resize(this->Base); }
+			} scope{ snapshot, base };
+
+			for (unsigned s = 0; s < this->ShardCount; ++s)
+			{
+				Shard& shard = this->Shards[s];
+				std::lock_guard<std::mutex> guard(shard.Lock);
+				snapshot.insert(snapshot.end(), shard.Member_Binds.begin(), shard.Member_Binds.end());
+			}
+
+			const std::size_t end = snapshot.size();
+			for (std::size_t i = base; i < end; ++i)
+			{
+				const auto& bind = snapshot[i];
+				if (bind->IsValid())
+				{
+					auto* sp = dynamic_cast<DLG_Details::DelHandler<DLG_Details::TypeGroup<RetT>, DLG_Details::TypeGroup<ParamsT...>, DLG_Details::TypeGroup<ArgsT...>>*>(bind.get());
+					if (sp != nullptr)
+					{
+						sp->Execute(in...);
+					}
+					else
+					{
+						std::cerr << "To many arguements or wrong types to execute. Return value may be undifined.\n";
+					}
+				}
+			}
+		}
+
+		//* Broadcast
+		template<typename... ArgsT>
+		void operator()(ArgsT... in) const
+		{
+			this->Broadcast(std::forward<ArgsT>(in)...);
+		}
+
+		//* Removes binds whose object expired, in every shard.
+		void Prune()
+		{
+			for (unsigned s = 0; s < this->ShardCount; ++s)
+			{
+				std::vector<HandlerPtr> removed;
+				Shard& shard = this->Shards[s];
+				std::lock_guard<std::mutex> guard(shard.Lock);
+				auto& binds = shard.Member_Binds;
+				for (std::size_t i = 0; i < binds.size(); )
+				{
+					if (binds[i]->IsValid() == false)
+					{
+						removed.push_back(std::move(binds[i]));
+						binds[i] = std::move(binds.back());
+						binds.pop_back();
+					}
+					else
+					{
+						++i;
+					}
+				}
+			}
+		}
+
+		//* Deletes all binds.
+		void Clear()
+		{
+			for (unsigned s = 0; s < this->ShardCount; ++s)
+			{
+				std::vector<HandlerPtr> removed;
+				{
+					std::lock_guard<std::mutex> guard(this->Shards[s].Lock);
+					removed.swap(this->Shards[s].Member_Binds);
+				}
+			}
+			WaitForBroadcasts();
+		}
+
+		//* Binds method. Allows duplicates.
+		template<typename... ArgsT>
+		void AddBind(FreeFunc func, ArgsT... in)
+		{
+			Push(DLG_Details::make_FreeDel<RetT>(func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//* Binds method provided that it is not already bound, in any shard.
+		template<typename... ArgsT>
+		void AddBindUnique(FreeFunc func, ArgsT... in)
+		{
+			PushUnique(static_cast<void*>(nullptr), func,
+				DLG_Details::make_FreeDel<RetT>(func, std::tuple<ParamsT...>(), std::tuple<ArgsT...>(in...)));
+		}
+
+		//@Return: True if method is bound; False, if not.
+		bool ContainsBind(FreeFunc func) const
+		{
+			return _Contains(static_cast<void*>(nullptr), func);
+		}
+
+		//* UnBinds all methods matching the function signature.
+		void RemoveBind(FreeFunc func)
+		{
+			_UnBind(static_cast<void*>(nullptr), func, false);
+		}
+
+		//* UnBinds the first bind that matches the function signature.
+		void RemoveBindSingle(FreeFunc func)
+		{
+			_UnBind(static_cast<void*>(nullptr), func, true);
+		}
+
+		//* Binds method. Allows duplicates.
+		template <typename ClassT, typename... ArgsT>
+		void AddBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			_Bind(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method. Allows duplicates.
+		template <typename ClassT, typename... ArgsT>
+		void AddBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			_Bind(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method. Allows duplicates.
+		template <typename ClassT, typename... ArgsT>
+		void AddBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			_Bind(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method. Allows duplicates.
+		template <typename ClassT, typename... ArgsT>
+		void AddBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			_Bind(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method provided that it is not already bound, in any shard.
+		template <typename ClassT, typename... ArgsT>
+		void AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			_BindUnique(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method provided that it is not already bound, in any shard.
+		template <typename ClassT, typename... ArgsT>
+		void AddBindUnique(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			_BindUnique(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method provided that it is not already bound, in any shard.
+		template <typename ClassT, typename... ArgsT>
+		void AddBindUnique(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func, ArgsT... in)
+		{
+			_BindUnique(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//* Binds method provided that it is not already bound, in any shard.
+		template <typename ClassT, typename... ArgsT>
+		void AddBindUnique(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func, ArgsT... in)
+		{
+			_BindUnique(target, func, std::forward<ArgsT>(in)...);
+		}
+
+		//@Return: True if object and method is bound; False, if not.
+		template <typename ClassT>
+		bool ContainsBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func) const
+		{
+			return _Contains(target, func);
+		}
+
+		//@Return: True if object and method is bound; False, if not.
+		template <typename ClassT>
+		bool ContainsBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func) const
+		{
+			return _Contains(target, func);
+		}
+
+		//@Return: True if object and method is bound; False, if not.
+		template <typename ClassT>
+		bool ContainsBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func) const
+		{
+			return _Contains(target.get(), func);
+		}
+
+		//@Return: True if object and method is bound; False, if not.
+		template <typename ClassT>
+		bool ContainsBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func) const
+		{
+			return _Contains(target.get(), func);
+		}
+
+		//* UnBinds all methods matching the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			_UnBind(target, func, false);
+		}
+
+		//* UnBinds all methods matching the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBind(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			_UnBind(target, func, false);
+		}
+
+		//* UnBinds the first bind that matches the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBindSingle(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			_UnBind(target, func, true);
+		}
+
+		//* UnBinds the first bind that matches the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBindSingle(ClassT* const& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			_UnBind(target, func, true);
+		}
+
+		//* UnBinds all methods matching the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			_UnBind(target.get(), func, false);
+		}
+
+		//* UnBinds all methods matching the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBind(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			_UnBind(target.get(), func, false);
+		}
+
+		//* UnBinds the first bind that matches the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBindSingle(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionSignature func)
+		{
+			_UnBind(target.get(), func, true);
+		}
+
+		//* UnBinds the first bind that matches the function signature and object instance.
+		template <typename ClassT>
+		void RemoveBindSingle(std::shared_ptr<ClassT>& target, typename MFSig<ClassT>::MemberFunctionConstSignature func)
+		{
+			_UnBind(target.get(), func, true);
+		}
+
+		//UnBinds all methods of object instance, in every shard.
+		template <typename ClassT>
+		void RemoveBindAllInstance(ClassT* const& target)
+		{
+			bool any = false;
+			for (unsigned s = 0; s < this->ShardCount; ++s)
+			{
+				std::vector<HandlerPtr> removed;
+				Shard& shard = this->Shards[s];
+				std::lock_guard<std::mutex> guard(shard.Lock);
+				auto& binds = shard.Member_Binds;
+				for (std::size_t i = 0; i < binds.size(); )
+				{
+					if (target == binds[i]->GetObjectPointer())
+					{
+						removed.push_back(std::move(binds[i]));
+						binds[i] = std::move(binds.back());
+						binds.pop_back();
+						any = true;
+					}
+					else
+					{
+						++i;
+					}
+				}
+			}
+			if (any)
+			{
+				WaitForBroadcasts();
+			}
+		}
+
+		//UnBinds all methods of object instance, in every shard.
+		template <typename ClassT>
+		void RemoveBindAllInstance(std::shared_ptr<ClassT>& target)
+		{
+			RemoveBindAllInstance(target.get());
+		}
+	};
+}
+
+#endif // !_SHARDED_DELEGATE_
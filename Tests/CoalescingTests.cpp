@@ -0,0 +1,103 @@
+//* Behaviour checks for CoalescingDelegates.h.
+//*   g++ -std=c++17 -I.. CoalescingTests.cpp -o CoalescingTests && ./CoalescingTests
+#include "CoalescingDelegates.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+	std::vector<int> Seen;
+
+	void Record(int value) { Seen.push_back(value); }
+
+	struct Window
+	{
+		int Width = 0;
+		int Height = 0;
+		int Resizes = 0;
+		void OnResize(int width, int height) { this->Width = width; this->Height = height; ++this->Resizes; }
+	};
+
+	//* Not convertible to MultiCastDelegate, so nothing can broadcast around the pending slot.
+	static_assert(std::is_convertible<DLG::CoalescingMultiCastDelegate<int>*, DLG::MultiCastDelegate<int>*>::value == false,
+		"Coalescing delegate must not expose its MultiCastDelegate.");
+
+	void FlushDeliversLatest()
+	{
+		DLG::CoalescingMultiCastDelegate<int, int> onResize;
+		auto window = std::make_shared<Window>();
+		onResize.AddBind(window, &Window::OnResize);
+		onResize.AddBindUnique(window, &Window::OnResize);
+		assert(onResize.Size() == 1);
+
+		onResize.Broadcast(100, 50);
+		onResize.Broadcast(200, 80);
+		onResize(300, 90);
+		assert(window->Resizes == 0 && onResize.HasPending());
+		assert(onResize.Flush() && onResize.Flush() == false);
+		assert(window->Resizes == 1 && window->Width == 300 && window->Height == 90);
+		assert(onResize.GetCoalescedCount() == 2 && onResize.GetDeliveredCount() == 1);
+
+		onResize.RemoveBindAllInstance(window);
+		onResize.Broadcast(1, 1);
+		onResize.Flush();
+		assert(window->Resizes == 1);
+	}
+
+	void MergeCombinesBroadcasts()
+	{
+		DLG::CoalescingMultiCastDelegate<int> onDelta;
+		onDelta.AddBind(&Record);
+		onDelta.SetMerge([](std::tuple<int>& pending, const int& incoming) { std::get<0>(pending) += incoming; });
+		Seen.clear();
+		onDelta.Broadcast(1);
+		onDelta.Broadcast(2);
+		onDelta.Broadcast(3);
+		onDelta.Flush();
+		assert(Seen.size() == 1 && Seen[0] == 6);
+	}
+
+	void CountPolicyDelivers()
+	{
+		DLG::CoalescingMultiCastDelegate<int> onValue;
+		onValue.AddBind(&Record);
+		onValue.SetMaxPending(3);
+		Seen.clear();
+		for (int i = 1; i <= 7; ++i)
+		{
+			onValue.Broadcast(i);
+		}
+		assert(Seen.size() == 2 && Seen[0] == 3 && Seen[1] == 6 && onValue.HasPending());
+		onValue.Discard();
+		assert(onValue.Flush() == false);
+	}
+
+	void IntervalPolicyDelivers()
+	{
+		DLG::CoalescingMultiCastDelegate<int> onValue;
+		onValue.AddBind(&Record);
+		onValue.SetMinInterval(std::chrono::milliseconds(5));
+		Seen.clear();
+		onValue.Broadcast(1); //first delivery is due right away.
+		onValue.Broadcast(2);
+		assert(Seen.size() == 1 && onValue.Poll() == false);
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		assert(onValue.Poll() && Seen.size() == 2 && Seen[1] == 2);
+	}
+}
+
+int main()
+{
+	FlushDeliversLatest();
+	MergeCombinesBroadcasts();
+	CountPolicyDelivers();
+	IntervalPolicyDelivers();
+	std::puts("CoalescingTests passed");
+	return 0;
+}
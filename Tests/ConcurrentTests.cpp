@@ -0,0 +1,147 @@
+//* Behaviour checks for ConcurrentDelegates.h.
+//*   g++ -std=c++17 -pthread -I.. ConcurrentTests.cpp -o ConcurrentTests && ./ConcurrentTests
+#include "ConcurrentDelegates.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct Config
+	{
+		int Value = 0;
+		int Get(int x, std::string) { return this->Value + x; }
+	};
+
+	int Free(int x, std::string tag) { return x + static_cast<int>(tag.size()); }
+
+	struct Doubler
+	{
+		int operator()(int x, std::string) { return x * 2; }
+	};
+
+	using Delegate = DLG::ConcurrentSingleCastDelegate<int, int, std::string>;
+
+	void EveryBindKind()
+	{
+		Delegate delegate;
+		assert(delegate.IsBound() == false && delegate.Execute(1) == 0);
+		delegate.BindFunction(&Free, std::string("abc"));
+		assert(delegate.Execute(1) == 4);
+		Doubler doubler;
+		delegate.BindFunctor(&doubler, std::string());
+		assert(delegate(5) == 10);
+		auto config = std::make_shared<Config>();
+		config->Value = 100;
+		delegate.Bind(config, &Config::Get, std::string("x"));
+		assert(delegate(1) == 101);
+		config.reset();
+		assert(delegate(1) == 0); //expired, silently the default value.
+		delegate.UnBind();
+		assert(delegate.IsBound() == false && delegate.Reclaim() == 0);
+	}
+
+	//* Rebinding while other threads execute: every result comes from one of the bound targets.
+	void RebindUnderExecute()
+	{
+		Delegate delegate;
+		auto steady = std::make_shared<Config>();
+		steady->Value = 100;
+		delegate.Bind(steady, &Config::Get, std::string());
+
+		std::atomic<bool> stop(false);
+		std::atomic<long> bad(0);
+		std::vector<std::thread> readers;
+		for (int t = 0; t < 4; ++t)
+		{
+			readers.emplace_back([&]()
+			{
+				while (stop.load() == false)
+				{
+					const int result = delegate.Execute(1);
+					if (result != 101 && result != 37 && result < 1000)
+					{
+						++bad;
+					}
+				}
+			});
+		}
+
+		std::vector<std::shared_ptr<Config>> kept;
+		for (int i = 0; i < 5000; ++i)
+		{
+			if (i % 3 == 0)
+			{
+				delegate.BindFunction(&Free, std::string(36, 'y'));
+			}
+			else if (i % 3 == 1)
+			{
+				kept.push_back(std::make_shared<Config>());
+				kept.back()->Value = 1000 + i;
+				delegate.Bind(kept.back(), &Config::Get, std::string());
+			}
+			else
+			{
+				delegate.Bind(steady, &Config::Get, std::string());
+			}
+		}
+		stop = true;
+		for (auto& reader : readers)
+		{
+			reader.join();
+		}
+		assert(bad == 0 && delegate.Reclaim() == 0);
+	}
+
+	std::atomic<int> Stage(0);
+
+	int Blocking(int x, std::shared_ptr<int>)
+	{
+		Stage.store(1);
+		while (Stage.load() != 2)
+		{
+			std::this_thread::yield();
+		}
+		return x;
+	}
+
+	int Plain(int x, std::shared_ptr<int>) { return x; }
+
+	//* A handler retired while an Execute() runs it is freed by later Execute() calls, with no further bind or Reclaim().
+	void ExecuteReclaimsRetired()
+	{
+		DLG::ConcurrentSingleCastDelegate<int, int, std::shared_ptr<int>> delegate;
+		auto token = std::make_shared<int>(0); //the payload tells when the retired handler is freed.
+		delegate.BindFunction(&Blocking, token);
+
+		std::thread reader([&]() { delegate.Execute(0); });
+		while (Stage.load() != 1)
+		{
+			std::this_thread::yield();
+		}
+		delegate.BindFunction(&Plain, std::shared_ptr<int>());
+		Stage.store(2);
+		reader.join();
+		assert(token.use_count() == 2); //retired, the bind could not free it while the reader ran.
+
+		for (int i = 0; i < 64; ++i)
+		{
+			assert(delegate.Execute(i) == i);
+		}
+		assert(token.use_count() == 1);
+	}
+}
+
+int main()
+{
+	EveryBindKind();
+	RebindUnderExecute();
+	ExecuteReclaimsRetired();
+	std::puts("ConcurrentTests passed");
+	return 0;
+}
@@ -0,0 +1,114 @@
+//* Behaviour checks for DelegateCoroutines.h. Needs C++20.
+//*   g++ -std=c++20 -pthread -I.. CoroutineTests.cpp -o CoroutineTests && ./CoroutineTests
+#include "DelegateCoroutines.h"
+
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+namespace
+{
+	DLG::MultiCastDelegate<int> OnValue;
+	DLG::MultiCastDelegate<int, std::string> OnPair;
+	DLG::MultiCastDelegate<> OnPing;
+
+	DLG::Task<> SumValues(int& out)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			out += co_await OnValue.Next();
+		}
+		auto [number, text] = co_await OnPair.Next();
+		out += number + static_cast<int>(text.size());
+		co_await OnPing.Next();
+		out += 1000;
+	}
+
+	DLG::Task<int> Square(int value)
+	{
+		co_return value * value;
+	}
+
+	DLG::Task<> CallSingleCast(DLG::SingleCastDelegate<DLG::Task<int>, int>& singleCast, int& out)
+	{
+		out = co_await singleCast.Execute(7);
+		DLG::SingleCastDelegate<DLG::Task<int>, int> unbound;
+		out += co_await unbound.Execute(1);
+	}
+
+	DLG::Task<> WaitOnMailbox(DLG::ThreadMailbox::Ptr mailbox, std::thread::id& resumedOn)
+	{
+		co_await OnValue.Next(mailbox);
+		resumedOn = std::this_thread::get_id();
+	}
+
+	DLG::Task<> WaitForever(bool& resumed)
+	{
+		co_await OnValue.Next();
+		resumed = true;
+	}
+
+	//* Each awaiter is resumed by exactly one Broadcast, with its arguements.
+	void NextResumesWithArguements()
+	{
+		int out = 0;
+		SumValues(out).Detach();
+		OnValue.Broadcast(1);
+		OnValue.Broadcast(2);
+		OnValue.Broadcast(3);
+		OnValue.Broadcast(100); //nobody waits on OnValue anymore.
+		OnPair.Broadcast(5, std::string("abc"));
+		assert(out == 14);
+		OnPing.Broadcast();
+		assert(out == 1014);
+	}
+
+	void SingleCastReturnsTask()
+	{
+		DLG::SingleCastDelegate<DLG::Task<int>, int> singleCast;
+		singleCast.BindFunction(&Square);
+		int out = 0;
+		CallSingleCast(singleCast, out).Detach();
+		assert(out == 49);
+	}
+
+	//* Tasks are lazy: a detached task waits, a task destroyed before starting never enlists.
+	void OnlyStartedTasksWait()
+	{
+		bool resumed = false;
+		{
+			DLG::Task<> task = WaitForever(resumed);
+			task.Detach();
+		}
+		OnValue.Broadcast(1);
+		assert(resumed);
+
+		bool abandoned = false;
+		{
+			DLG::Task<> task = WaitForever(abandoned); //never started, never enlisted.
+		}
+		OnValue.Broadcast(1);
+		assert(abandoned == false);
+	}
+
+	void MailboxResumesOnOwner()
+	{
+		std::thread::id resumedOn;
+		WaitOnMailbox(DLG::ThreadMailbox::Current(), resumedOn).Detach();
+		std::thread([]() { OnValue.Broadcast(1); }).join();
+		assert(resumedOn == std::thread::id());
+		DLG::PumpDelegates();
+		assert(resumedOn == std::this_thread::get_id());
+	}
+}
+
+int main()
+{
+	NextResumesWithArguements();
+	SingleCastReturnsTask();
+	OnlyStartedTasksWait();
+	MailboxResumesOnOwner();
+	std::puts("CoroutineTests passed");
+	return 0;
+}
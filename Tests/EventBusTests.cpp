@@ -0,0 +1,119 @@
+//* Behaviour checks for EventBus.h.
+//*   g++ -std=c++17 -I.. EventBusTests.cpp -o EventBusTests && ./EventBusTests
+#include "EventBus.h"
+
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	BUS_EVENT(OnScore, int);
+	BUS_EVENT(OnName, std::string);
+	BUS_EVENT(OnTagged, int, std::string);
+
+	using Bus = DLG::EventBus<OnScore, OnName, OnTagged>;
+
+	std::vector<std::string> Tags;
+
+	void Tag(int value, std::string tag) { Tags.push_back(tag + std::to_string(value)); }
+
+	struct Player
+	{
+		int Score = 0;
+		std::string Name;
+		void AddScore(int value) { this->Score += value; }
+		void DoubleScore(int value) { this->Score += 2 * value; }
+		void SetName(std::string name) { this->Name = name; }
+	};
+
+	void PublishReachesSubscribers()
+	{
+		Bus bus;
+		Player player;
+		bus.Subscribe<OnScore>(&player, &Player::AddScore);
+		bus.Subscribe<OnName>(&player, &Player::SetName);
+		bus.Publish<OnScore>(5);
+		bus.Publish<OnName>(std::string("ann"));
+		assert(player.Score == 5 && player.Name == "ann");
+		static_assert(Bus::EventCount() == 3, "three events");
+	}
+
+	//* A free function subscribed with a payload picks the free function overload.
+	void FreeFunctionWithPayload()
+	{
+		Bus bus;
+		Tags.clear();
+		bus.Subscribe<OnTagged>(&Tag, std::string("hp"));
+		bus.Publish<OnTagged>(3);
+		assert(Tags.size() == 1 && Tags[0] == "hp3");
+		bus.Unsubscribe<OnTagged>(&Tag);
+		bus.Publish<OnTagged>(4);
+		assert(Tags.size() == 1);
+	}
+
+	//* The reverse index keeps an event until the object's last bind to it is removed.
+	void UnsubscribePrunesIndex()
+	{
+		Bus bus;
+		Player player;
+		bus.Subscribe<OnScore>(&player, &Player::AddScore);
+		bus.Subscribe<OnScore>(&player, &Player::DoubleScore);
+		bus.Subscribe<OnName>(&player, &Player::SetName);
+		assert(bus.SubscriberCount() == 1);
+
+		bus.Unsubscribe<OnScore>(&player, &Player::AddScore);
+		bus.Unsubscribe<OnName>(&player, &Player::SetName);
+		assert(bus.SubscriberCount() == 1);
+		bus.Publish<OnScore>(1);
+		assert(player.Score == 2);
+
+		bus.Unsubscribe<OnScore>(&player, &Player::DoubleScore);
+		assert(bus.SubscriberCount() == 0);
+	}
+
+	void UnsubscribeAllVisitsEveryEvent()
+	{
+		Bus bus;
+		auto player = std::make_shared<Player>();
+		bus.Subscribe<OnScore>(player, &Player::AddScore);
+		bus.Subscribe<OnName>(player, &Player::SetName);
+		bus.UnsubscribeAll(player);
+		bus.Publish<OnScore>(5);
+		bus.Publish<OnName>(std::string("bob"));
+		assert(player->Score == 0 && player->Name.empty() && bus.SubscriberCount() == 0);
+	}
+
+	//* Expired shared_ptr subscribers leave the index on Prune, and on their own as the index grows.
+	void ExpiredSubscribersArePruned()
+	{
+		Bus bus;
+		{
+			auto player = std::make_shared<Player>();
+			bus.Subscribe<OnScore>(player, &Player::AddScore);
+		}
+		assert(bus.SubscriberCount() == 1);
+		bus.Prune();
+		assert(bus.SubscriberCount() == 0);
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			auto player = std::make_shared<Player>();
+			bus.Subscribe<OnScore>(player, &Player::AddScore);
+		}
+		assert(bus.SubscriberCount() <= 32);
+	}
+}
+
+int main()
+{
+	PublishReachesSubscribers();
+	FreeFunctionWithPayload();
+	UnsubscribePrunesIndex();
+	UnsubscribeAllVisitsEveryEvent();
+	ExpiredSubscribersArePruned();
+	std::puts("EventBusTests passed");
+	return 0;
+}
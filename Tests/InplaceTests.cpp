@@ -0,0 +1,111 @@
+//* Behaviour checks for InplaceDelegates.h.
+//*   g++ -std=c++17 -I.. InplaceTests.cpp -o InplaceTests && ./InplaceTests
+#include "InplaceDelegates.h"
+
+#include <cassert>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	std::vector<std::string> Received;
+
+	struct Printer
+	{
+		void On(std::string text) { Received.push_back(text); }
+	};
+
+	int Twice(int value) { return value * 2; }
+
+	//* Payload whose copy throws on demand.
+	struct Fragile
+	{
+		static bool Throw;
+		Fragile() = default;
+		Fragile(const Fragile&) { if (Throw) { throw std::runtime_error("copy"); } }
+	};
+	bool Fragile::Throw = false;
+
+	void TakesFragile(int, Fragile) {}
+	int ReturnsWithFragile(int value, Fragile) { return value; }
+
+	//* Every listener receives the broadcast arguements, not a moved-from copy.
+	void MultiCastArgumentsReachEveryListener()
+	{
+		DLG::InplaceMultiCastDelegate<4, 64, std::string> multiCast;
+		Printer a, b;
+		multiCast.AddBind(&a, &Printer::On);
+		multiCast.AddBind(&b, &Printer::On);
+		Received.clear();
+		multiCast.Broadcast(std::string("hello"));
+		assert(Received.size() == 2 && Received[0] == "hello" && Received[1] == "hello");
+
+		const auto& constCast = multiCast;
+		Received.clear();
+		constCast.Broadcast(std::string("again"));
+		assert(Received.size() == 2 && Received[1] == "again");
+	}
+
+	void CapacityAndRemoval()
+	{
+		DLG::InplaceMultiCastDelegate<2, 64, std::string> multiCast;
+		Printer a, b, c;
+		assert(multiCast.AddBind(&a, &Printer::On));
+		assert(multiCast.AddBindUnique(&a, &Printer::On) == false);
+		assert(multiCast.AddBind(&b, &Printer::On));
+		assert(multiCast.AddBind(&c, &Printer::On) == false && multiCast.OverflowCount() == 1);
+		multiCast.RemoveBind(&a, &Printer::On);
+		assert(multiCast.Size() == 1 && multiCast.AddBind(&c, &Printer::On));
+	}
+
+	//* A throwing payload copy must not leak the slot.
+	void ThrowingBindKeepsSlots()
+	{
+		DLG::InplaceMultiCastDelegate<1, 64, int, Fragile> multiCast;
+		for (int i = 0; i < 3; ++i)
+		{
+			Fragile::Throw = true;
+			bool threw = false;
+			try { multiCast.AddBind(&TakesFragile, Fragile()); }
+			catch (const std::runtime_error&) { threw = true; }
+			Fragile::Throw = false;
+			assert(threw && multiCast.Size() == 0);
+		}
+		assert(multiCast.AddBind(&TakesFragile, Fragile()) && multiCast.Size() == 1);
+
+		DLG::InplaceSingleCastDelegate<64, int, int, Fragile> singleCast;
+		for (int i = 0; i < 3; ++i)
+		{
+			Fragile::Throw = true;
+			try { singleCast.BindFunction(&ReturnsWithFragile, Fragile()); }
+			catch (const std::runtime_error&) {}
+			Fragile::Throw = false;
+			assert(singleCast.IsBound() == false);
+		}
+		singleCast.BindFunction(&ReturnsWithFragile, Fragile());
+		assert(singleCast.Execute(7) == 7);
+	}
+
+	void SingleCastRebinds()
+	{
+		DLG::InplaceSingleCastDelegate<64, int, int> singleCast;
+		singleCast.BindFunction(&Twice);
+		assert(singleCast(4) == 8);
+		singleCast.BindFunction(&Twice);
+		assert(singleCast(5) == 10);
+		singleCast.UnBind();
+		assert(singleCast.IsBound() == false);
+	}
+}
+
+int main()
+{
+	MultiCastArgumentsReachEveryListener();
+	CapacityAndRemoval();
+	ThrowingBindKeepsSlots();
+	SingleCastRebinds();
+	std::puts("InplaceTests passed");
+	return 0;
+}
@@ -0,0 +1,119 @@
+//* Behaviour checks for DelegateInstrumentation.h.
+//*   g++ -std=c++17 -DDLG_INSTRUMENTATION -I.. InstrumentationTests.cpp -o InstrumentationTests && ./InstrumentationTests
+#ifndef DLG_INSTRUMENTATION
+#define DLG_INSTRUMENTATION
+#endif
+#include "Delegates.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+	using DLG_Instrumentation::LatencyHistogram;
+
+	//* Every value lands in a bucket whose lower bound is within 12.5% below it.
+	void BucketsBoundValues()
+	{
+		for (std::uint64_t ns : { 0ull, 1ull, 7ull, 8ull, 9ull, 15ull, 16ull, 1000ull, 123456789ull, 1ull << 40 })
+		{
+			const std::uint64_t low = LatencyHistogram::BucketLowerBound(LatencyHistogram::BucketIndex(ns));
+			assert(low <= ns && ns - low <= ns / 8);
+		}
+		assert(LatencyHistogram::BucketIndex(~0ull) < LatencyHistogram::BucketCount);
+	}
+
+	//* Percentiles of 1..1000 ns come back within the bucket error.
+	void PercentilesOfKnownSamples()
+	{
+		LatencyHistogram histogram;
+		assert(histogram.Percentile(50) == 0 && histogram.Count() == 0);
+		for (std::uint64_t ns = 1; ns <= 1000; ++ns)
+		{
+			histogram.Record(ns);
+		}
+		assert(histogram.Count() == 1000 && histogram.MaxValue() == 1000);
+		const std::uint64_t p50 = histogram.Percentile(50);
+		const std::uint64_t p99 = histogram.Percentile(99);
+		assert(p50 <= 500 && p50 >= 500 - 500 / 8);
+		assert(p99 <= 990 && p99 >= 990 - 990 / 8);
+		assert(histogram.Percentile(100) <= 1000 && histogram.Percentile(0) == 1);
+
+		LatencyHistogram other;
+		other.Record(5000);
+		histogram.Merge(other);
+		assert(histogram.Count() == 1001 && histogram.MaxValue() == 5000);
+		histogram.Reset();
+		assert(histogram.Count() == 0 && histogram.MaxValue() == 0);
+	}
+
+	struct Listener
+	{
+		int Calls = 0;
+		void On(int) { ++this->Calls; }
+		void Slow(int) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); }
+	};
+
+	MULTI_CAST_DELEGATE(OnValue, int)
+
+	//* Broadcasts record counts per delegate, named through the constructor.
+	void DelegateCounts()
+	{
+		OnValue multiCast("OnValue");
+		Listener a, b;
+		multiCast.AddBind(&a, &Listener::On);
+		multiCast.AddBind(&b, &Listener::On);
+		multiCast.Broadcast(1);
+		multiCast.Broadcast(2);
+
+		const DLG_Instrumentation::DelegateStats& stats = multiCast.GetStats();
+		assert(std::string(stats.GetName()) == "OnValue" && std::string(multiCast.GetDebugName()) == "OnValue");
+		assert(stats.BroadcastCount() == 2 && stats.InvokeCount() == 4 && stats.ListenerCount() == 2);
+		assert(stats.GetBroadcastLatency().Count() == 2 && stats.GetListenerLatency().Count() == 4);
+		assert(stats.SlowListenerCount() == 0);
+
+		DLG::SingleCastDelegate<void, int> singleCast("Single");
+		singleCast.BindRaw(&a, &Listener::On);
+		singleCast.Execute(3);
+		assert(singleCast.GetStats().BroadcastCount() == 1 && singleCast.GetStats().InvokeCount() == 1);
+
+		std::ostringstream out;
+		DLG_Instrumentation::DumpAll(out);
+		assert(out.str().find("OnValue") != std::string::npos && out.str().find("Single") != std::string::npos);
+	}
+
+	//* Listeners over the budget are reported by object.
+	void SlowListeners()
+	{
+		const std::uint64_t budget = DLG_Instrumentation::SlowListenerBudgetNs().load();
+		DLG_Instrumentation::SlowListenerBudgetNs() = 1000000;
+		OnValue multiCast;
+		Listener fast, slow;
+		multiCast.AddBind(&fast, &Listener::On);
+		multiCast.AddBind(&slow, &Listener::Slow);
+		multiCast.Broadcast(1);
+		assert(multiCast.GetStats().SlowListenerCount() == 1);
+
+		std::ostringstream out;
+		multiCast.GetStats().Dump(out);
+		std::ostringstream object;
+		object << static_cast<const void*>(&slow);
+		assert(out.str().find("slow listener object=" + object.str()) != std::string::npos);
+		DLG_Instrumentation::SlowListenerBudgetNs() = budget;
+	}
+}
+
+int main()
+{
+	BucketsBoundValues();
+	PercentilesOfKnownSamples();
+	DelegateCounts();
+	SlowListeners();
+	std::puts("InstrumentationTests passed");
+	return 0;
+}
@@ -0,0 +1,170 @@
+//* Behaviour checks for KeyedDelegates.h.
+//*   g++ -std=c++17 -I.. KeyedTests.cpp -o KeyedTests && ./KeyedTests
+#include "KeyedDelegates.h"
+
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using Delegate = DLG::KeyedMultiCastDelegate<int, int, std::string>;
+
+	struct Listener
+	{
+		int Calls = 0;
+		void On(int, std::string) { ++this->Calls; }
+		void OnConst(int, std::string) const { ++ConstCalls; }
+		static int ConstCalls;
+	};
+	int Listener::ConstCalls = 0;
+
+	int FreeCalls = 0;
+	void Free(int, std::string) { ++FreeCalls; }
+
+	void RoutesByKey()
+	{
+		Delegate delegate;
+		Listener unkeyed, one, two;
+		delegate.AddBind(&unkeyed, &Listener::On);
+		delegate.AddBindKeyed(1, &one, &Listener::On);
+		delegate.AddBindKeyed(1, &one, &Listener::OnConst);
+		delegate.AddBindKeyed(2, &two, &Listener::On);
+		delegate.AddBindKeyed(2, &Free);
+		assert(delegate.Size() == 5 && delegate.GetKeyCount() == 2 && delegate.CountKey(1) == 2);
+
+		delegate.Broadcast(1, std::string("a"));
+		assert(unkeyed.Calls == 1 && one.Calls == 1 && Listener::ConstCalls == 1 && two.Calls == 0 && FreeCalls == 0);
+		delegate(2, std::string("b"));
+		assert(unkeyed.Calls == 2 && two.Calls == 1 && FreeCalls == 1);
+		delegate.Broadcast(7, std::string());
+		assert(unkeyed.Calls == 3 && one.Calls == 1 && two.Calls == 1);
+
+		delegate.RemoveBindKeyed(2, &Free);
+		assert(delegate.CountKey(2) == 1);
+		delegate.RemoveBindAllInstance(&one);
+		assert(delegate.CountKey(1) == 0 && delegate.GetKeyCount() == 1);
+		delegate.RemoveKey(2);
+		assert(delegate.GetKeyCount() == 0 && delegate.Size() == 1);
+	}
+
+	//* Members inherited from MultiCastDelegate see the keyed binds too.
+	void QueriesSeeKeyedBinds()
+	{
+		Delegate delegate;
+		auto shared = std::make_shared<Listener>();
+		assert(delegate.HasLiveListeners() == false && delegate.MemoryUsage().HandlerBytes == 0);
+		delegate.AddBindKeyed(4, shared, &Listener::On);
+		assert(delegate.HasLiveListeners() && delegate.ContainsInstance(shared));
+		const DLG::DelegateMemoryUsage usage = delegate.MemoryUsage();
+		assert(usage.Binds == 1 && usage.HandlerBytes > 0 && usage.StorageBytes > 0);
+		shared.reset();
+		assert(delegate.HasLiveListeners() == false && delegate.MemoryUsage().DeadBinds == 1);
+
+		Listener unkeyed;
+		delegate.AddBindUnique(&unkeyed, &Listener::On);
+		delegate.AddBindUnique(&unkeyed, &Listener::On);
+		assert(delegate.ContainsBind(&unkeyed, &Listener::On) && delegate.ContainsInstance(&unkeyed) && delegate.Size() == 2);
+		delegate.RemoveBind(&unkeyed, &Listener::On);
+		assert(delegate.ContainsInstance(&unkeyed) == false);
+	}
+
+	void PrunesExpired()
+	{
+		Delegate delegate;
+		auto shared = std::make_shared<Listener>();
+		delegate.AddBindKeyed(3, shared, &Listener::On);
+		delegate.Broadcast(3, std::string());
+		assert(shared->Calls == 1);
+		shared.reset();
+		delegate.Broadcast(3, std::string());
+		assert(delegate.CountKey(3) == 0 && delegate.GetKeyCount() == 0 && delegate.Size() == 0);
+	}
+
+	void CustomExtractor()
+	{
+		DLG::KeyedMultiCastDelegate<std::size_t, int, std::string> delegate(
+			[](const int&, const std::string& name) { return name.size(); });
+		Listener listener;
+		delegate.AddBindKeyed(3, &listener, &Listener::On);
+		delegate.Broadcast(0, std::string("abc"));
+		delegate.Broadcast(0, std::string("ab"));
+		assert(listener.Calls == 1);
+	}
+
+	//* Removes binds of its own bucket while that bucket is being broadcast.
+	struct Remover
+	{
+		Delegate* Owner;
+		Listener* Later = nullptr;
+		std::vector<int>* Order;
+		int Id;
+
+		void RemoveSelf(int key, std::string) { this->Order->push_back(this->Id); this->Owner->RemoveBindKeyed(key, this, &Remover::RemoveSelf); }
+		void RemoveLater(int key, std::string) { this->Order->push_back(this->Id); this->Owner->RemoveBindKeyed(key, this->Later, &Listener::On); }
+		void RemoveKey(int key, std::string) { this->Order->push_back(this->Id); this->Owner->RemoveKey(key); }
+		void RemoveInstance(int, std::string) { this->Order->push_back(this->Id); this->Owner->RemoveBindAllInstance(this->Later); }
+		void ClearAll(int, std::string) { this->Order->push_back(this->Id); this->Owner->Clear(); }
+		void Nested(int key, std::string) { this->Order->push_back(this->Id); if (key == 1) { this->Owner->Broadcast(2, std::string()); this->Owner->RemoveKey(2); } }
+	};
+
+	void RemovalDuringBroadcast()
+	{
+		std::vector<int> order;
+		Delegate delegate;
+		Listener later;
+		Remover first{ &delegate, &later, &order, 1 }, second{ &delegate, &later, &order, 2 }, third{ &delegate, &later, &order, 3 };
+
+		//self removal keeps the order of the rest, and the removed bind is not called again.
+		delegate.AddBindKeyed(1, &first, &Remover::RemoveSelf);
+		delegate.AddBindKeyed(1, &second, &Remover::RemoveSelf);
+		delegate.AddBindKeyed(1, &third, &Remover::RemoveSelf);
+		delegate.Broadcast(1, std::string());
+		assert((order == std::vector<int>{ 1, 2, 3 }) && delegate.GetKeyCount() == 0 && delegate.Size() == 0);
+
+		//a bind removed before its turn is skipped.
+		order.clear();
+		delegate.AddBindKeyed(1, &first, &Remover::RemoveLater);
+		delegate.AddBindKeyed(1, &later, &Listener::On);
+		delegate.AddBindKeyed(1, &second, &Remover::RemoveInstance);
+		delegate.Broadcast(1, std::string());
+		assert(later.Calls == 0 && (order == std::vector<int>{ 1, 2 }) && delegate.CountKey(1) == 2 && delegate.Size() == 2);
+		delegate.RemoveKey(1);
+
+		order.clear();
+		delegate.AddBindKeyed(1, &first, &Remover::RemoveKey);
+		delegate.AddBindKeyed(1, &second, &Remover::RemoveKey);
+		delegate.Broadcast(1, std::string());
+		assert((order == std::vector<int>{ 1 }) && delegate.GetKeyCount() == 0);
+
+		order.clear();
+		delegate.AddBindKeyed(1, &first, &Remover::ClearAll);
+		delegate.AddBindKeyed(1, &later, &Listener::On);
+		delegate.AddBindKeyed(2, &later, &Listener::On);
+		delegate.Broadcast(1, std::string());
+		assert(later.Calls == 0 && delegate.Size() == 0 && delegate.GetKeyCount() == 0);
+
+		//removal in a nested broadcast waits for the outer one.
+		order.clear();
+		delegate.AddBindKeyed(1, &first, &Remover::Nested);
+		delegate.AddBindKeyed(2, &second, &Remover::Nested);
+		delegate.AddBindKeyed(1, &third, &Remover::Nested);
+		delegate.Broadcast(1, std::string());
+		assert((order == std::vector<int>{ 1, 2, 3 }) && delegate.GetKeyCount() == 1 && delegate.CountKey(1) == 2);
+		delegate.Broadcast(2, std::string());
+		assert(order.size() == 3);
+	}
+}
+
+int main()
+{
+	RoutesByKey();
+	QueriesSeeKeyedBinds();
+	PrunesExpired();
+	CustomExtractor();
+	RemovalDuringBroadcast();
+	std::puts("KeyedTests passed");
+	return 0;
+}
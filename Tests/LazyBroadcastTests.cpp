@@ -0,0 +1,93 @@
+//* Behaviour checks for MultiCastDelegate::HasLiveListeners() and BroadcastLazy() in Delegates.h.
+//*   g++ -std=c++17 -I.. LazyBroadcastTests.cpp -o LazyBroadcastTests && ./LazyBroadcastTests
+#include "Delegates.h"
+
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <tuple>
+
+namespace
+{
+	struct Listener
+	{
+		int Total = 0;
+		std::string Last;
+		void On(int value, std::string text) { this->Total += value; this->Last = text; }
+	};
+
+	int FreeTotal = 0;
+	void Free(int value, std::string) { FreeTotal += value; }
+
+	//* The factory runs only when a bind is alive, and its tuple is spread over the arguements.
+	void FactoryOnlyForLiveBinds()
+	{
+		DLG::MultiCastDelegate<int, std::string> multiCast;
+		int built = 0;
+		auto factory = [&built]() { ++built; return std::make_tuple(2, std::string("built")); };
+		assert(multiCast.BroadcastLazy(factory) == false && built == 0);
+
+		auto a = std::make_shared<Listener>();
+		auto b = std::make_shared<Listener>();
+		multiCast.AddBind(a, &Listener::On);
+		multiCast.AddBind(b, &Listener::On);
+		assert(multiCast.BroadcastLazy(factory) && built == 1);
+		assert(a->Total == 2 && a->Last == "built" && b->Total == 2);
+
+		a.reset();
+		b.reset();
+		assert(multiCast.BroadcastLazy(factory) == false && built == 1);
+
+		multiCast.AddBind(&Free);
+		assert(multiCast.BroadcastLazy(factory) && built == 2 && FreeTotal == 2);
+	}
+
+	//* The non-const overload removes the expired binds it passes; the const one leaves them.
+	void PruningByOverload()
+	{
+		DLG::MultiCastDelegate<int, std::string> multiCast;
+		auto a = std::make_shared<Listener>();
+		auto b = std::make_shared<Listener>();
+		multiCast.AddBind(a, &Listener::On);
+		multiCast.AddBind(b, &Listener::On);
+		a.reset();
+		b.reset();
+
+		const DLG::MultiCastDelegate<int, std::string>& constView = multiCast;
+		assert(constView.HasLiveListeners() == false && multiCast.Size() == 2 && multiCast.MemoryUsage().DeadBinds == 2);
+		assert(multiCast.HasLiveListeners() == false && multiCast.Size() == 0);
+
+		//stops at the first live bind, checked from the back.
+		auto alive = std::make_shared<Listener>();
+		auto dead = std::make_shared<Listener>();
+		multiCast.AddBind(alive, &Listener::On);
+		multiCast.AddBind(dead, &Listener::On);
+		dead.reset();
+		assert(multiCast.HasLiveListeners() && multiCast.Size() == 1);
+		assert(constView.HasLiveListeners());
+	}
+
+	//* Raw and free binds never expire, so both overloads answer without scanning or pruning.
+	void PersistentBindsAreLive()
+	{
+		DLG::MultiCastDelegate<int, std::string> multiCast;
+		auto dead = std::make_shared<Listener>();
+		Listener raw;
+		multiCast.AddBind(dead, &Listener::On);
+		multiCast.AddBind(&raw, &Listener::On);
+		dead.reset();
+		assert(multiCast.HasLiveListeners() && multiCast.Size() == 2);
+		multiCast.RemoveBind(&raw, &Listener::On);
+		assert(multiCast.HasLiveListeners() == false && multiCast.Size() == 0);
+	}
+}
+
+int main()
+{
+	FactoryOnlyForLiveBinds();
+	PruningByOverload();
+	PersistentBindsAreLive();
+	std::puts("LazyBroadcastTests passed");
+	return 0;
+}
@@ -0,0 +1,119 @@
+//* Behaviour checks for DelegateMailbox.h.
+//*   g++ -std=c++17 -pthread -I.. MailboxTests.cpp -o MailboxTests && ./MailboxTests
+#include "DelegateMailbox.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::atomic<int> FreeTotal(0);
+
+	void AddFree(int value) { FreeTotal += value; }
+
+	struct Widget
+	{
+		std::thread::id Seen;
+		int Total = 0;
+		std::vector<std::string> Texts;
+
+		void OnValue(int value) { this->Seen = std::this_thread::get_id(); this->Total += value; }
+		void OnText(std::string text) { this->Texts.push_back(text); }
+	};
+
+	//* Broadcasts on the owning thread call the bind inline.
+	void OwnerRunsInline()
+	{
+		auto widget = std::make_shared<Widget>();
+		DLG::MultiCastDelegate<int> multiCast;
+		multiCast.AddBindOn(DLG::ThreadMailbox::Current(), widget, &Widget::OnValue);
+		multiCast.Broadcast(3);
+		assert(widget->Total == 3 && DLG::PumpDelegates() == 0);
+	}
+
+	//* Broadcasts from other threads are posted and run by the owner's Pump().
+	void OtherThreadsPost()
+	{
+		FreeTotal = 0;
+		auto widget = std::make_shared<Widget>();
+		DLG::MultiCastDelegate<int> multiCast;
+		multiCast.AddBindOn(DLG::ThreadMailbox::Current(), widget, &Widget::OnValue);
+		multiCast.AddBindOn(DLG::ThreadMailbox::Current(), &AddFree);
+
+		//MultiCastDelegate is not thread safe, the broadcasting threads take turns.
+		std::mutex broadcastLock;
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 4; ++t)
+		{
+			threads.emplace_back([&multiCast, &broadcastLock]()
+			{
+				for (int i = 0; i < 1000; ++i)
+				{
+					std::lock_guard<std::mutex> guard(broadcastLock);
+					multiCast.Broadcast(1);
+				}
+			});
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+		assert(widget->Total == 0 && FreeTotal == 0);
+		assert(DLG::PumpDelegates() == 8000);
+		assert(widget->Total == 4000 && FreeTotal == 4000 && widget->Seen == std::this_thread::get_id());
+	}
+
+	//* Every posted listener gets the arguements; a bind removed before the Pump() is not called, even when
+	//* its raw target is already gone.
+	void RemovedBindIsNotCalled()
+	{
+		auto shared = std::make_shared<Widget>();
+		Widget* raw = new Widget();
+		Widget kept;
+		DLG::MultiCastDelegate<std::string> multiCast;
+		multiCast.AddBindOn(DLG::ThreadMailbox::Current(), shared, &Widget::OnText);
+		multiCast.AddBindOn(DLG::ThreadMailbox::Current(), raw, &Widget::OnText);
+		multiCast.AddBindOn(DLG::ThreadMailbox::Current(), &kept, &Widget::OnText);
+		std::thread([&multiCast]() { multiCast.Broadcast(std::string("posted")); }).join();
+		multiCast.RemoveBind(shared, &Widget::OnText);
+		multiCast.RemoveBind(raw, &Widget::OnText);
+		delete raw;
+		assert(DLG::PumpDelegates() == 3);
+		assert(shared->Texts.empty() && kept.Texts.size() == 1 && kept.Texts[0] == "posted");
+
+		std::thread([&multiCast]() { multiCast.Broadcast(std::string("cleared")); }).join();
+		multiCast.Clear();
+		assert(DLG::PumpDelegates() == 1 && kept.Texts.size() == 1);
+	}
+
+	//* Tasks never pumped are released with the mailbox.
+	void UnpumpedTasksAreReleased()
+	{
+		auto widget = std::make_shared<Widget>();
+		DLG::ThreadMailbox::Ptr mailbox = DLG::ThreadMailbox::Create();
+		{
+			DLG::MultiCastDelegate<int> multiCast;
+			multiCast.AddBindOn(mailbox, widget, &Widget::OnValue);
+			multiCast.Broadcast(1);
+			multiCast.Broadcast(1);
+		}
+		mailbox.reset();
+		assert(widget->Total == 0 && widget.use_count() == 1);
+	}
+}
+
+int main()
+{
+	OwnerRunsInline();
+	OtherThreadsPost();
+	RemovedBindIsNotCalled();
+	UnpumpedTasksAreReleased();
+	std::puts("MailboxTests passed");
+	return 0;
+}
@@ -0,0 +1,91 @@
+//* Behaviour checks for MemoizedDelegates.h.
+//*   g++ -std=c++17 -I.. MemoizedTests.cpp -o MemoizedTests && ./MemoizedTests
+#include "MemoizedDelegates.h"
+
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace
+{
+	int Calls = 0;
+
+	int Square(int value) { ++Calls; return value * value; }
+	int Cube(int value) { ++Calls; return value * value * value; }
+
+	struct Scaler
+	{
+		int Factor = 10;
+		int Scale(int value) { ++Calls; return value * this->Factor; }
+	};
+
+	using Memo = DLG::MemoizedSingleCastDelegate<8, int, int>;
+
+	void RepeatedArgumentsHit()
+	{
+		Memo memo;
+		memo.BindFunction(&Square);
+		Calls = 0;
+		assert(memo.Execute(3) == 9 && memo(3) == 9 && memo(4) == 16);
+		assert(Calls == 2 && memo.GetHitCount() == 1 && memo.GetMissCount() == 2);
+	}
+
+	//* Rebinding through the base class or a pipeline empties the cache too.
+	void EveryRebindInvalidates()
+	{
+		Memo memo;
+		memo.BindFunction(&Square);
+		assert(memo(2) == 4);
+
+		DLG::SingleCastDelegate<int, int>& base = memo;
+		base.BindFunction(&Cube);
+		assert(memo(2) == 8);
+
+		memo.Map([](int value) { return value + 1; }).Bind(&Square);
+		assert(memo(2) == 9);
+
+		memo.Filter([](int value) { return value > 0; }).Bind(&Cube);
+		assert(memo(2) == 8 && memo(-2) == 0);
+
+		base.UnBind();
+		base.BindFunction(&Square);
+		assert(memo(2) == 4);
+	}
+
+	//* Calls that never reach the function are not cached.
+	void MissedCallsAreNotCached()
+	{
+		Memo memo;
+		assert(memo(5) == 0 && memo(5) == 0 && memo.GetHitCount() == 0);
+
+		auto scaler = std::make_shared<Scaler>();
+		memo.Bind(scaler, &Scaler::Scale);
+		assert(memo(1) == 10);
+		scaler.reset();
+		Calls = 0;
+		assert(memo(2) == 0 && memo(2) == 0 && Calls == 0 && memo.GetHitCount() == 0);
+	}
+
+	//* Results cached from a shared target are not returned once it expired.
+	void ExpiredTargetDropsCache()
+	{
+		Memo memo;
+		auto scaler = std::make_shared<Scaler>();
+		memo.Bind(scaler, &Scaler::Scale);
+		assert(memo(3) == 30 && memo(3) == 30 && memo.GetHitCount() == 1);
+
+		scaler.reset();
+		assert(memo(3) == 0 && memo(3) == 0 && memo.GetHitCount() == 1 && memo.GetMissCount() == 3);
+	}
+}
+
+int main()
+{
+	RepeatedArgumentsHit();
+	EveryRebindInvalidates();
+	MissedCallsAreNotCached();
+	ExpiredTargetDropsCache();
+	std::puts("MemoizedTests passed");
+	return 0;
+}
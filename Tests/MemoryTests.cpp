@@ -0,0 +1,109 @@
+//* Behaviour checks for the DLG_MEMORY_ACCOUNTING handler totals.
+//*   g++ -std=c++17 -DDLG_MEMORY_ACCOUNTING -I.. MemoryTests.cpp -o MemoryTests && ./MemoryTests
+#ifndef DLG_MEMORY_ACCOUNTING
+#define DLG_MEMORY_ACCOUNTING
+#endif
+#include "Delegates.h"
+#include "InplaceDelegates.h"
+
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace
+{
+	struct Listener
+	{
+		void On(int) {}
+		int Twice(int value) { return value * 2; }
+	};
+
+	void Free(int) {}
+
+	bool SameTotals(const DLG::DelegateMemoryUsage& a, const DLG::DelegateMemoryUsage& b)
+	{
+		return a.Binds == b.Binds && a.HandlerBytes == b.HandlerBytes && a.PayloadBytes == b.PayloadBytes;
+	}
+
+	//* Handlers are counted with their payload while bound, and the totals return after Clear and destruction.
+	void MultiCastReturnsToBaseline()
+	{
+		const DLG::DelegateMemoryUsage baseline = DLG::GlobalMemoryUsage();
+		{
+			DLG::MultiCastDelegate<int> multiCast;
+			Listener raw;
+			std::shared_ptr<Listener> shared = std::make_shared<Listener>();
+			multiCast.AddBind(&raw, &Listener::On);
+			multiCast.AddBind(shared, &Listener::On);
+			multiCast.AddBind(&Free);
+
+			DLG::DelegateMemoryUsage bound = DLG::GlobalMemoryUsage();
+			assert(bound.Binds == baseline.Binds + 3);
+			assert(bound.HandlerBytes - baseline.HandlerBytes == multiCast.MemoryUsage().HandlerBytes);
+
+			multiCast.RemoveBind(&raw, &Listener::On);
+			assert(DLG::GlobalMemoryUsage().Binds == baseline.Binds + 2);
+			multiCast.Clear();
+			assert(SameTotals(DLG::GlobalMemoryUsage(), baseline));
+
+			multiCast.AddBind(shared, &Listener::On);
+			multiCast.AddBind(&Free);
+		}
+		assert(SameTotals(DLG::GlobalMemoryUsage(), baseline));
+	}
+
+	//* Payload bytes are tracked separately and released with their handler.
+	void SingleCastReturnsToBaseline()
+	{
+		const DLG::DelegateMemoryUsage baseline = DLG::GlobalMemoryUsage();
+		{
+			DLG::SingleCastDelegate<void, int> singleCast;
+			Listener raw;
+			singleCast.BindRaw(&raw, &Listener::On);
+			assert(DLG::GlobalMemoryUsage().Binds == baseline.Binds + 1);
+
+			DLG::SingleCastDelegate<void, int> withPayload;
+			withPayload.BindRaw(&raw, &Listener::On, 5);
+			assert(DLG::GlobalMemoryUsage().PayloadBytes > baseline.PayloadBytes);
+
+			singleCast.UnBind();
+			singleCast.BindRaw(&raw, &Listener::On);
+			singleCast.BindFunction(&Free);
+			assert(DLG::GlobalMemoryUsage().Binds == baseline.Binds + 2);
+		}
+		assert(SameTotals(DLG::GlobalMemoryUsage(), baseline));
+	}
+
+	//* Inplace handlers live in the delegate's own storage but are counted in the totals too.
+	void InplaceReturnsToBaseline()
+	{
+		const DLG::DelegateMemoryUsage baseline = DLG::GlobalMemoryUsage();
+		{
+			DLG::InplaceMultiCastDelegate<4, 64, int> multiCast;
+			DLG::InplaceSingleCastDelegate<64, int, int> singleCast;
+			Listener raw;
+			multiCast.AddBind(&raw, &Listener::On);
+			multiCast.AddBind(&Free);
+			singleCast.BindRaw(&raw, &Listener::Twice);
+			assert(DLG::GlobalMemoryUsage().Binds == baseline.Binds + 3);
+
+			multiCast.Clear();
+			singleCast.UnBind();
+			assert(SameTotals(DLG::GlobalMemoryUsage(), baseline));
+
+			multiCast.AddBind(&raw, &Listener::On);
+			singleCast.BindRaw(&raw, &Listener::Twice);
+		}
+		assert(SameTotals(DLG::GlobalMemoryUsage(), baseline));
+	}
+}
+
+int main()
+{
+	MultiCastReturnsToBaseline();
+	SingleCastReturnsToBaseline();
+	InplaceReturnsToBaseline();
+	std::puts("MemoryTests passed");
+	return 0;
+}
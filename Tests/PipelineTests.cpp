@@ -0,0 +1,92 @@
+//* Behaviour checks for delegate.Filter()/Map() pipelines.
+//*   g++ -std=c++17 -I.. PipelineTests.cpp -o PipelineTests && ./PipelineTests
+#include "Delegates.h"
+
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+	std::vector<std::string> Log;
+
+	void LogKm(double km) { Log.push_back("km" + std::to_string(static_cast<int>(km))); }
+
+	struct Unit
+	{
+		double Meters = 0;
+		int Calls = 0;
+		void OnMeters(double meters) { this->Meters += meters; ++this->Calls; }
+		void OnPair(int id, std::string text) { Log.push_back(std::to_string(id) + text); }
+		int Twice(int value) { return value * 2; }
+		int& Slot(int) { return this->Calls; }
+	};
+
+	//* Each stage runs in order; a failed Filter stops the chain for that bind only.
+	void MultiCastStagesRunInOrder()
+	{
+		DLG::MultiCastDelegate<int, double> onPosition;
+		Unit unit;
+		auto shared = std::make_shared<Unit>();
+		onPosition.Filter([](int id, double) { return id == 7; }).Map([](int, double feet) { return feet * 0.3048; }).Bind(&unit, &Unit::OnMeters);
+		onPosition.Map([](int, double meters) { return meters / 1000.0; }).Bind(&LogKm);
+		onPosition.Filter([](int id, double) { return id > 0; })
+			.Map([](int id, double) { return std::make_tuple(id, std::string("x")); }).Bind(shared, &Unit::OnPair);
+		assert(onPosition.Size() == 3);
+
+		Log.clear();
+		onPosition.Broadcast(7, 1000.0);
+		onPosition.Broadcast(-1, 5000.0);
+		assert(unit.Calls == 1 && unit.Meters > 304.7 && unit.Meters < 304.9);
+		assert(Log.size() == 3 && Log[0] == "km1" && Log[1] == "7x" && Log[2] == "km5");
+
+		onPosition.RemoveBindAllInstance(&unit);
+		shared.reset();
+		Log.clear();
+		onPosition.Broadcast(7, 2000.0);
+		assert(unit.Calls == 1 && Log.size() == 1 && Log[0] == "km2");
+	}
+
+	void SingleCastReturnsThroughStages()
+	{
+		DLG::SingleCastDelegate<int, int> square;
+		square.Filter([](int value) { return value >= 0; }).Map([](int value) { return value * value; }).Bind([](int value) { return value + 1; });
+		assert(square.Execute(5) == 26 && square.Execute(-5) == 0);
+
+		Unit unit;
+		square.Map([](int value) { return value + 1; }).Bind(&unit, &Unit::Twice);
+		assert(square(3) == 8);
+	}
+
+	//* A pipeline ending in an expired shared_ptr returns the default value.
+	void ExpiredTargetReturnsDefault()
+	{
+		DLG::SingleCastDelegate<int, int> twice;
+		auto unit = std::make_shared<Unit>();
+		twice.Filter([](int) { return true; }).Bind(unit, &Unit::Twice);
+		assert(twice(4) == 8);
+		unit.reset();
+		assert(twice(4) == 0);
+
+		//a method returning a reference, on a target that expires.
+		DLG::SingleCastDelegate<int, int> slot;
+		auto other = std::make_shared<Unit>();
+		other->Calls = 9;
+		slot.Map([](int value) { return value; }).Bind(other, &Unit::Slot);
+		assert(slot(1) == 9);
+		other.reset();
+		assert(slot(1) == 0);
+	}
+}
+
+int main()
+{
+	MultiCastStagesRunInOrder();
+	SingleCastReturnsThroughStages();
+	ExpiredTargetReturnsDefault();
+	std::puts("PipelineTests passed");
+	return 0;
+}
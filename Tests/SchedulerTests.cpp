@@ -0,0 +1,128 @@
+//* Behaviour checks for DelegateScheduler.h.
+//*   g++ -std=c++17 -pthread -I.. SchedulerTests.cpp -o SchedulerTests && ./SchedulerTests
+#include "DelegateScheduler.h"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::uint64_t CurrentTick = 0;
+
+	//* Checks each timer fires on the tick it was scheduled for.
+	struct Expectation
+	{
+		int Fired = 0;
+		int Late = 0;
+		void On(std::uint64_t due) { ++this->Fired; this->Late += (due != CurrentTick); }
+	};
+
+	void Run(DLG::DelegateScheduler& scheduler)
+	{
+		while (scheduler.Size() != 0)
+		{
+			++CurrentTick;
+			scheduler.AdvanceTicks(1);
+		}
+	}
+
+	//* Near and far timers, across every wheel level, fire on their tick; cancelled ones never fire.
+	void TimersFireOnTheirTick()
+	{
+		DLG::DelegateScheduler scheduler(std::chrono::milliseconds(1));
+		DLG::MultiCastDelegate<std::uint64_t> onDue;
+		Expectation expectation;
+		onDue.AddBind(&expectation, &Expectation::On);
+
+		CurrentTick = 0;
+		std::vector<DLG::TimerToken> tokens;
+		const std::uint64_t delays[] = { 1, 2, 63, 64, 65, 300, 4095, 4096, 70000, (std::uint64_t(1) << 24) + 12345 };
+		for (std::uint64_t delay : delays)
+		{
+			tokens.push_back(scheduler.ScheduleAfter(std::chrono::milliseconds(delay), onDue, delay));
+		}
+		DLG::TimerToken cancelled = scheduler.ScheduleAfter(std::chrono::milliseconds(500), onDue, std::uint64_t(500));
+		assert(scheduler.Cancel(cancelled) && cancelled.IsValid() == false && scheduler.Cancel(cancelled) == false);
+
+		Run(scheduler);
+		assert(expectation.Fired == 10 && expectation.Late == 0);
+		assert(scheduler.Cancel(tokens[0]) == false);
+	}
+
+	struct Repeater
+	{
+		int Count = 0;
+		DLG::DelegateScheduler* Scheduler = nullptr;
+		DLG::TimerToken Token;
+		void On() { if (++this->Count == 5) { this->Scheduler->Cancel(this->Token); } }
+	};
+
+	//* A periodic timer can cancel itself from inside its call.
+	void PeriodicCancelsItself()
+	{
+		DLG::DelegateScheduler scheduler(std::chrono::milliseconds(1));
+		DLG::SingleCastDelegate<void> onTick;
+		Repeater repeater;
+		repeater.Scheduler = &scheduler;
+		onTick.BindRaw(&repeater, &Repeater::On);
+		repeater.Token = scheduler.ScheduleEvery(std::chrono::milliseconds(10), onTick);
+		scheduler.AdvanceTicks(1000);
+		assert(repeater.Count == 5 && scheduler.Size() == 0);
+	}
+
+	void CancelAllDropsTimers()
+	{
+		DLG::DelegateScheduler scheduler(std::chrono::milliseconds(1));
+		DLG::MultiCastDelegate<std::uint64_t> onDue;
+		Expectation expectation;
+		onDue.AddBind(&expectation, &Expectation::On);
+		for (std::uint64_t i = 1; i <= 100; ++i)
+		{
+			scheduler.ScheduleAfter(std::chrono::milliseconds(i), onDue, i);
+		}
+		scheduler.CancelAll();
+		assert(scheduler.Size() == 0);
+		scheduler.AdvanceTicks(200);
+		assert(expectation.Fired == 0);
+	}
+
+	struct Counter
+	{
+		std::atomic<int> Hits{ 0 };
+		void On() { ++this->Hits; }
+	};
+
+	void ThreadDrivesTimers()
+	{
+		DLG::DelegateScheduler scheduler(std::chrono::microseconds(200));
+		DLG::SingleCastDelegate<void> onTick;
+		Counter counter;
+		onTick.BindRaw(&counter, &Counter::On);
+		scheduler.StartThread();
+		for (int i = 0; i < 20; ++i)
+		{
+			scheduler.ScheduleAfter(std::chrono::milliseconds(1 + i % 5), onTick);
+		}
+		while (scheduler.Size() != 0)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		scheduler.StopThread();
+		assert(counter.Hits == 20);
+	}
+}
+
+int main()
+{
+	TimersFireOnTheirTick();
+	PeriodicCancelsItself();
+	CancelAllDropsTimers();
+	ThreadDrivesTimers();
+	std::puts("SchedulerTests passed");
+	return 0;
+}
@@ -0,0 +1,163 @@
+//* Behaviour checks for ShardedDelegates.h.
+//*   g++ -std=c++17 -pthread -I.. ShardedTests.cpp -o ShardedTests && ./ShardedTests
+#include "ShardedDelegates.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::atomic<int> FreeTotal(0);
+
+	void AddFree(int value) { FreeTotal += value; }
+	void Throws(int, std::shared_ptr<int>) { throw std::runtime_error("listener"); }
+
+	struct Counter
+	{
+		std::atomic<int> Total{ 0 };
+		void On(int value) { this->Total += value; }
+	};
+
+	//* Binds made on one thread are removed by RemoveBind on another, and Broadcast reaches every shard.
+	void BindsSpreadOverShards()
+	{
+		DLG::ShardedMultiCastDelegate<int> multiCast(4);
+		Counter counter;
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 4; ++t)
+		{
+			threads.emplace_back([&]() { multiCast.AddBind(&counter, &Counter::On); });
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+		assert(multiCast.Size() == 4 && multiCast.ContainsBind(&counter, &Counter::On));
+		multiCast.Broadcast(2);
+		assert(counter.Total == 8);
+
+		multiCast.RemoveBindSingle(&counter, &Counter::On);
+		assert(multiCast.Size() == 3);
+		multiCast.RemoveBind(&counter, &Counter::On);
+		assert(multiCast.Size() == 0 && multiCast.ContainsBind(&counter, &Counter::On) == false);
+	}
+
+	//* Racing AddBindUnique calls leave exactly one bind.
+	void UniqueAcrossShards()
+	{
+		DLG::ShardedMultiCastDelegate<int> multiCast(8);
+		auto counter = std::make_shared<Counter>();
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 8; ++t)
+		{
+			threads.emplace_back([&]()
+			{
+				for (int i = 0; i < 100; ++i)
+				{
+					multiCast.AddBindUnique(counter, &Counter::On);
+					multiCast.AddBindUnique(&AddFree);
+				}
+			});
+		}
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+		assert(multiCast.Size() == 2 && multiCast.ContainsBind(&AddFree));
+		FreeTotal = 0;
+		multiCast.Broadcast(1);
+		assert(counter->Total == 1 && FreeTotal == 1);
+	}
+
+	//* A throwing listener must not leave its snapshot, and the handlers it holds, behind on this thread.
+	void ThrowingListenerPopsSnapshot()
+	{
+		auto payload = std::make_shared<int>(0);
+		DLG::ShardedMultiCastDelegate<int, std::shared_ptr<int>> multiCast(2);
+		multiCast.AddBind(&Throws, payload);
+		bool threw = false;
+		try { multiCast.Broadcast(1); }
+		catch (const std::runtime_error&) { threw = true; }
+		multiCast.Clear();
+		assert(threw && payload.use_count() == 1);
+	}
+
+	DLG::ShardedMultiCastDelegate<int>* Running = nullptr;
+
+	struct OneShot
+	{
+		int Calls = 0;
+		void On(int) { ++this->Calls; Running->RemoveBind(this, &OneShot::On); }
+	};
+
+	//* Listeners may unbind themselves while the broadcast is running.
+	void UnbindDuringBroadcast()
+	{
+		DLG::ShardedMultiCastDelegate<int> multiCast;
+		Running = &multiCast;
+		OneShot oneShot;
+		multiCast.AddBind(&oneShot, &OneShot::On);
+		multiCast.Broadcast(1);
+		multiCast.Broadcast(1);
+		assert(oneShot.Calls == 1 && multiCast.Size() == 0);
+		Running = nullptr;
+	}
+
+	std::atomic<int> DeadCalls(0);
+
+	struct Fragile
+	{
+		std::atomic<unsigned> Magic{ 0xC0FFEEu };
+		~Fragile() { this->Magic = 0; }
+		void On(int) { if (this->Magic.load() != 0xC0FFEEu) { ++DeadCalls; } std::this_thread::yield(); if (this->Magic.load() != 0xC0FFEEu) { ++DeadCalls; } }
+	};
+
+	//* Raw targets may be deleted as soon as RemoveBind returns, while other threads keep broadcasting.
+	void RemoveBindWaitsForBroadcasts()
+	{
+		DLG::ShardedMultiCastDelegate<int> multiCast(4);
+		std::atomic<bool> stop(false);
+		std::vector<std::thread> publishers;
+		for (int t = 0; t < 3; ++t)
+		{
+			publishers.emplace_back([&]() { while (stop.load() == false) { multiCast.Broadcast(1); } });
+		}
+		for (int i = 0; i < 300; ++i)
+		{
+			Fragile* fragile = new Fragile();
+			multiCast.AddBind(fragile, &Fragile::On);
+			std::this_thread::yield();
+			if (i % 2 == 0)
+			{
+				multiCast.RemoveBind(fragile, &Fragile::On);
+			}
+			else
+			{
+				multiCast.RemoveBindAllInstance(fragile);
+			}
+			delete fragile;
+		}
+		stop = true;
+		for (auto& publisher : publishers)
+		{
+			publisher.join();
+		}
+		assert(DeadCalls == 0 && multiCast.Size() == 0);
+	}
+}
+
+int main()
+{
+	BindsSpreadOverShards();
+	UniqueAcrossShards();
+	ThrowingListenerPopsSnapshot();
+	UnbindDuringBroadcast();
+	RemoveBindWaitsForBroadcasts();
+	std::puts("ShardedTests passed");
+	return 0;
+}
@@ -0,0 +1,113 @@
+//* Behaviour checks for DelegateTracing.h.
+//*   g++ -std=c++17 -DDLG_TRACING -I.. TracingTests.cpp -o TracingTests && ./TracingTests
+#ifndef DLG_TRACING
+#define DLG_TRACING
+#endif
+#include "Delegates.h"
+
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+	struct Listener
+	{
+		int Calls = 0;
+		void On(int) { ++this->Calls; }
+	};
+
+	MULTI_CAST_DELEGATE(OnValue, int)
+
+	std::string ReadFile(const char* path)
+	{
+		std::ifstream file(path);
+		std::stringstream text;
+		text << file.rdbuf();
+		return text.str();
+	}
+
+	std::size_t CountOf(const std::string& text, const std::string& part)
+	{
+		std::size_t count = 0;
+		for (std::size_t at = text.find(part); at != std::string::npos; at = text.find(part, at + part.size()))
+		{
+			++count;
+		}
+		return count;
+	}
+
+	const char* const TracePath = "TracingTests.json";
+
+	//* One broadcast span per Broadcast and one execute span per listener call, named after the delegate.
+	void WritesBroadcastAndExecuteSpans()
+	{
+		OnValue multiCast("OnValue");
+		Listener a, b;
+		multiCast.AddBind(&a, &Listener::On);
+		multiCast.AddBind(&b, &Listener::On);
+		multiCast.Broadcast(1);
+		multiCast.Broadcast(2);
+
+		DLG::SingleCastDelegate<void, int> singleCast("Single");
+		singleCast.BindRaw(&a, &Listener::On);
+		singleCast.Execute(3);
+
+		assert(DLG_Tracing::WriteChromeTrace(TracePath) == true);
+		const std::string json = ReadFile(TracePath);
+		assert(json.find("{\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":0},\"traceEvents\":[") == 0);
+		assert(json.find("\n]}\n") == json.size() - 4);
+		assert(CountOf(json, "\"name\":\"OnValue\",\"cat\":\"broadcast\",\"ph\":\"X\"") == 2);
+		assert(CountOf(json, "\"name\":\"OnValue\",\"cat\":\"execute\",\"ph\":\"X\"") == 4);
+		assert(CountOf(json, "\"name\":\"Single\",\"cat\":\"execute\",\"ph\":\"X\"") == 1);
+		assert(CountOf(json, "\"dur\":") == 7);
+
+		//the buffers were emptied by the write.
+		assert(DLG_Tracing::WriteChromeTrace(TracePath) == true);
+		assert(CountOf(ReadFile(TracePath), "\"ph\":\"X\"") == 0);
+		std::remove(TracePath);
+	}
+
+	//* A path that cannot be opened leaves the spans for the next write.
+	void FailedOpenKeepsSpans()
+	{
+		OnValue multiCast("Kept");
+		Listener a;
+		multiCast.AddBind(&a, &Listener::On);
+		multiCast.Broadcast(1);
+
+		assert(DLG_Tracing::WriteChromeTrace("no/such/dir/trace.json") == false);
+		assert(DLG_Tracing::WriteChromeTrace(TracePath) == true);
+		const std::string json = ReadFile(TracePath);
+		assert(CountOf(json, "\"name\":\"Kept\",\"cat\":\"broadcast\"") == 1);
+		assert(CountOf(json, "\"name\":\"Kept\",\"cat\":\"execute\"") == 1);
+		std::remove(TracePath);
+	}
+
+	//* SampleEvery records one in N top level broadcasts, 0 records none.
+	void SamplingSkipsBroadcasts()
+	{
+		OnValue multiCast("Sampled");
+		Listener a;
+		multiCast.AddBind(&a, &Listener::On);
+
+		DLG_Tracing::TraceConfig::SampleEvery() = 0;
+		multiCast.Broadcast(1);
+		DLG_Tracing::TraceConfig::SampleEvery() = 1;
+		assert(a.Calls == 1);
+		assert(DLG_Tracing::WriteChromeTrace(TracePath) == true);
+		assert(CountOf(ReadFile(TracePath), "\"ph\":\"X\"") == 0);
+		std::remove(TracePath);
+	}
+}
+
+int main()
+{
+	WritesBroadcastAndExecuteSpans();
+	FailedOpenKeepsSpans();
+	SamplingSkipsBroadcasts();
+	std::puts("TracingTests passed");
+	return 0;
+}